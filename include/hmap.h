@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file hmap.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Hash map public apis (open addressing and separate chaining)
+ *
+ */
+
+#ifndef HMAP_H_
+#define HMAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Includes
+#include "hmap_datatypes.h"
+#include "hmap_defines.h"
+
+/**
+ * Description:
+ *   Defines a global open addressing hash map `map` for a given key and value type and its capacity
+ *    (length). Keys are compared byte-wise so they shall be POD types with no padding (or zeroed).
+ *    The length shall be a power of two >= 16, at most 7/8 of it can be filled.
+ *
+ * Usage:
+ *   HMAP_CREATE(uint32_t, struct foo, foo_map, 64);
+ */
+#define HMAP_CREATE(ktype, vtype, map, length) _HMAP_DEF_TYPE(ktype, vtype, map, length)
+
+/**
+ * Description:
+ *   Defines a global separate chaining hash map `map` for a given key and value type with a number of
+ *    buckets (power of two). Every bucket is a linked list, entries are allocated on insertion so
+ *    it's meant for large payloads or an unknown number of keys.
+ *
+ * Usage:
+ *   HMAP_CHAIN_CREATE(uint32_t, struct big_foo, big_map, 256);
+ */
+#define HMAP_CHAIN_CREATE(ktype, vtype, map, buckets) _HMAP_CHAIN_DEF_TYPE(ktype, vtype, map, buckets)
+
+/**
+ * Description:
+ *   Inserts (or updates) the value pointed to by `val` under the key pointed to by `key`.
+ *   Valid for both HMAP_CREATE and HMAP_CHAIN_CREATE maps.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Error (allocation error on chained maps)
+ *   2 - Out of space (open addressing maps)
+ */
+#define HMAP_PUT(map, key, val) map##_put_refd(key, val)
+
+/**
+ * Description:
+ *   Copies the value stored under the key pointed to by `key` into the location pointed to by `val`.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Not found
+ */
+#define HMAP_GET(map, key, val) map##_get_refd(key, val)
+
+/**
+ * Description:
+ *   Removes the key pointed to by `key` and its value from the map.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Not found
+ */
+#define HMAP_REMOVE(map, key) map##_remove(key)
+
+/**
+ * \brief    Hashes a key as a sequence of bytes
+ * \param    key - reference to the key
+ * \param    len - key size in bytes
+ * \return   64-bit hash of the key
+ */
+uint64_t hmap_hash_bytes(void const *key, uint32_t len);
+
+/**
+ * \brief    Initializes an open addressing hash map with user provided storage
+ * \param    map - hash map handle
+ * \param    ctrl - control bytes storage, one byte per slot
+ * \param    slots - slots storage, `capacity` slots of `slot_sz` bytes
+ * \param    capacity - number of slots, power of two >= 16
+ * \param    key_sz - key size, the key is placed at the start of the slot
+ * \param    slot_sz - size of a slot
+ * \param    val_offs - offset of the value within the slot
+ * \param    val_sz - value size, copied in and out of the slot
+ * \return   OK if successful, NOT_OK otherwise.
+ */
+base_t hmap_init(hmap_handle_t map, uint8_t *const ctrl, void *const slots, uint32_t const capacity,
+                 uint16_t const key_sz, uint16_t const slot_sz, uint16_t const val_offs,
+                 uint16_t const val_sz);
+
+/**
+ * \brief    Removes all the keys, putting the map in a known state
+ * \param    map - hash map handle
+ * \return   OK if successful, NOT_OK otherwise.
+ */
+base_t hmap_reset(hmap_handle_t map);
+
+/**
+ * \brief    Inserts the value under the key, if the key already exists its value is updated
+ * \param    map - hash map handle
+ * \param    key - reference to the key
+ * \param    val - reference to the value to be copied
+ * \return   OK if successful, NOT_OK on invalid args. BUSY_W if the map is full
+ */
+base_t hmap_put(hmap_handle_t map, void const *key, void const *val);
+
+/**
+ * \brief    Retrieves the value stored under the key
+ * \param    map - hash map handle
+ * \param    key - reference to the key
+ * \param    val - reference where the value is copied
+ * \return   OK if found, NOT_OK otherwise
+ */
+base_t hmap_get(hmap_handle_t map, void const *key, void *val);
+
+/**
+ * \brief    Finds the value stored under the key
+ * \param    map - hash map handle
+ * \param    key - reference to the key
+ * \return   a reference to the value in place, valid until the key is removed. NULL if not found
+ */
+void *hmap_find(hmap_handle_t map, void const *key);
+
+/**
+ * \brief    Removes the key and its value
+ * \param    map - hash map handle
+ * \param    key - reference to the key
+ * \return   OK if found and removed, NOT_OK otherwise
+ */
+base_t hmap_remove(hmap_handle_t map, void const *key);
+
+/**
+ * \brief    Provides the number of keys in the map
+ * \param    map - hash map handle
+ * \return   number of keys, 0 if empty or NULL is provided
+ */
+uint32_t hmap_size(hmap_handle_t map);
+
+/**
+ * \brief    Initializes a separate chaining hash map with user provided buckets
+ * \param    map - chained hash map handle
+ * \param    buckets - buckets storage, `n_buckets` list handles
+ * \param    n_buckets - number of buckets, power of two
+ * \param    key_sz - key size, the key is placed at the start of the entry
+ * \param    val_offs - offset of the value within the entry
+ * \param    val_sz - value size
+ * \return   OK if successful, NOT_OK otherwise.
+ */
+base_t hmap_chain_init(hmap_chain_handle_t map, ll_handle_t *const buckets, uint32_t const n_buckets,
+                       uint16_t const key_sz, uint32_t const val_offs, uint32_t const val_sz);
+
+/**
+ * \brief    Inserts the value under the key, if the key already exists its value is updated
+ * \param    map - chained hash map handle
+ * \param    key - reference to the key
+ * \param    val - reference to the value to be copied
+ * \return   OK if successful, NOT_OK on invalid args or allocation error
+ */
+base_t hmap_chain_put(hmap_chain_handle_t map, void const *key, void const *val);
+
+/**
+ * \brief    Retrieves the value stored under the key
+ * \param    map - chained hash map handle
+ * \param    key - reference to the key
+ * \param    val - reference where the value is copied
+ * \return   OK if found, NOT_OK otherwise
+ */
+base_t hmap_chain_get(hmap_chain_handle_t map, void const *key, void *val);
+
+/**
+ * \brief    Finds the value stored under the key
+ * \param    map - chained hash map handle
+ * \param    key - reference to the key
+ * \return   a reference to the value in place, valid until the key is removed. NULL if not found
+ */
+void *hmap_chain_find(hmap_chain_handle_t map, void const *key);
+
+/**
+ * \brief    Removes the key and frees its entry
+ * \param    map - chained hash map handle
+ * \param    key - reference to the key
+ * \return   OK if found and removed, NOT_OK otherwise
+ */
+base_t hmap_chain_remove(hmap_chain_handle_t map, void const *key);
+
+/**
+ * \brief    Provides the number of keys in the map
+ * \param    map - chained hash map handle
+ * \return   number of keys, 0 if empty or NULL is provided
+ */
+uint32_t hmap_chain_size(hmap_chain_handle_t map);
+
+/**
+ * \brief    Deletes all the entries and frees the memory, the buckets are left empty
+ * \param    map - chained hash map handle
+ */
+void hmap_chain_delete(hmap_chain_handle_t map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HMAP_H_ */
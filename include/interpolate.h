@@ -34,7 +34,104 @@
 #define INTERPOLATE_H_
 
 // Includes
-#include "utils_common.h"
+#include "interpolation/interpolate_datatypes.h"
+#include "interpolation/interpolate_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Description:
+ *   Defines a global lookup table object `table` and the storage for the precomputed segments of a
+ *    dataset with `length` samples (length > 1). The table is empty until it's built.
+ *
+ * Usage:
+ *   INTERP_TABLE_CREATE(steering_lut, 5);
+ *   INTERP_TABLE_BUILD(steering_lut, a_data, v_data);
+ */
+#define INTERP_TABLE_CREATE(table, length) _INTERP_DEF_TABLE(table, length)
+
+/**
+ * Description:
+ *   Builds the table created by INTERP_TABLE_CREATE from the `domain` and `range` arrays, which shall
+ *   hold the `length` samples given on its creation.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Error, invalid data or domain not strictly increasing
+ */
+#define INTERP_TABLE_BUILD(table, domain, range)   \
+  interpolated_table_init(&table, table##_segs, domain, range, \
+                          (int32_t)(sizeof(table##_segs) / sizeof(interp_seg_t)) + 1)
+
+/**
+ * Description:
+ *   Defines a global fixed-point lookup table object `table` (Q15 samples, int16_t) and the storage for the
+ *   precomputed segments of a dataset with `length` samples (length > 1).
+ *
+ * Usage:
+ *   INTERP_Q15_TABLE_CREATE(adc_lut, 16);
+ *   INTERP_Q15_TABLE_BUILD(adc_lut, adc_data, out_data);
+ */
+#define INTERP_Q15_TABLE_CREATE(table, length) _INTERP_DEF_QTABLE(q15, table, length)
+#define INTERP_Q15_TABLE_BUILD(table, domain, range) \
+  interpolated_q15_table_init(&table, table##_segs, domain, range, \
+                              (int32_t)(sizeof(table##_segs) / sizeof(interp_qseg_t)) + 1)
+
+/**
+ * Description:
+ *   Same as INTERP_Q15_TABLE_CREATE and INTERP_Q15_TABLE_BUILD for Q31 samples (int32_t).
+ */
+#define INTERP_Q31_TABLE_CREATE(table, length) _INTERP_DEF_QTABLE(q31, table, length)
+#define INTERP_Q31_TABLE_BUILD(table, domain, range) \
+  interpolated_q31_table_init(&table, table##_segs, domain, range, \
+                              (int32_t)(sizeof(table##_segs) / sizeof(interp_qseg_t)) + 1)
+
+/**
+ * Description:
+ *   Defines a global lookup table object `table` with the storage of a uniform grid of up to `capacity`
+ *   samples. INTERP_RESAMPLE_BUILD resamples an irregular table on the smallest uniform grid whose error
+ *   is <= max_err (see `interpolated_resample`).
+ *
+ * Usage:
+ *   INTERP_RESAMPLED_CREATE(fast_lut, 256);
+ *   INTERP_RESAMPLE_BUILD(fast_lut, a_data, v_data, 5, 0.01f, &report);
+ */
+#define INTERP_RESAMPLED_CREATE(table, capacity) _INTERP_DEF_RESAMPLED(table, capacity)
+#define INTERP_RESAMPLE_BUILD(table, domain, range, length, max_err, report) \
+  interpolated_resample(&table, table##_domain, table##_range, table##_segs, \
+                        (int32_t)(sizeof(table##_domain) / sizeof(float32_t)), domain, range, length, \
+                        max_err, report)
+
+/**
+ * Description:
+ *   Defines a global bank object `bank` and its storage for `count` tables of `length` samples (length > 1)
+ *   sharing a domain. INTERP_BANK_BUILD builds it from the domain and an array of `count` ranges.
+ *
+ * Usage:
+ *   INTERP_BANK_CREATE(angle_bank, 5, 12);
+ *   INTERP_BANK_BUILD(angle_bank, a_data, ranges);
+ */
+#define INTERP_BANK_CREATE(bank, length, count) _INTERP_DEF_BANK(bank, length, count)
+#define INTERP_BANK_BUILD(bank, domain, ranges) \
+  interpolated_bank_init(&bank, &bank##_values[0][0], &bank##_slopes[0][0], &bank##_icepts[0][0], domain, \
+                         ranges, (int32_t)(sizeof(bank##_values) / sizeof(bank##_values[0])), \
+                         (int32_t)(sizeof(bank##_values[0]) / sizeof(float32_t)))
+
+/**
+ * Description:
+ *   Defines a global cubic spline object `spline` and the storage for the cubics of a dataset with `length`
+ *   samples (length > 1). INTERP_SPLINE_BUILD builds it as a natural spline or a monotone PCHIP (`kind`).
+ *
+ * Usage:
+ *   INTERP_SPLINE_CREATE(torque_map, 9);
+ *   INTERP_SPLINE_BUILD(torque_map, rpm_data, nm_data, INTERP_SPLINE_PCHIP);
+ */
+#define INTERP_SPLINE_CREATE(spline, length) _INTERP_DEF_SPLINE(spline, length)
+#define INTERP_SPLINE_BUILD(spline, domain, range, kind) \
+  interpolated_spline_init(&spline, spline##_cubics, domain, range, \
+                           (int32_t)(sizeof(spline##_cubics) / sizeof(interp_cubic_t)) + 1, kind)
 
 /**
  * @brief Calculates the interpolated constant value based on given data points.
@@ -69,4 +166,320 @@ float32_t interpolated_constant(float32_t const m, float32_t const x0, float32_t
 float32_t interpolated_estimate(float32_t const input, float32_t const *domain, float32_t const *range,
                                 int32_t length);
 
+/**
+ * @brief Builds a lookup table object from the given data points.
+ *
+ * The table keeps a reference to the arrays (they are not copied), precomputes the slope and intercept of
+ * every segment and detects whether the domain is uniformly spaced. Uniform tables find the segment in
+ * O(1) by computing its index, irregular ones use a branch-light binary search (O(log length)). The
+ * estimation is then a search plus a multiply-add.
+ *
+ * @param table The table object to be built.
+ * @param segs The storage for the length - 1 precomputed segments (can be NULL if length is 1).
+ * @param domain The array containing the sampled input data (x-axis), strictly increasing.
+ * @param range The array containing the sampled output data (y-axis).
+ * @param length The length of the input and output arrays.
+ * @return OK if successful, NOT_OK on invalid args or if the domain is not strictly increasing.
+ */
+base_t interpolated_table_init(interp_table_t *table, interp_seg_t *segs, float32_t const *domain,
+                               float32_t const *range, int32_t length);
+
+/**
+ * @brief Finds the segment of the table holding the input value.
+ *
+ * @param input The input value to look up.
+ * @param table The table object.
+ * @return The index i such as domain[i] <= input < domain[i+1], clamped to [0, length-2].
+ */
+int32_t interpolated_table_segment(float32_t const input, interp_table_t const *table);
+
+/**
+ * @brief Estimates the output value based on the input and a table object.
+ *
+ * Same behavior as `interpolated_estimate` (LUT hit, interpolation, saturation and 0 on a NaN input) with a
+ * faster segment lookup.
+ *
+ * @param input The input value for which the output needs to be estimated.
+ * @param table The table object.
+ * @return The estimated output value, 0 if the table is not valid.
+ */
+float32_t interpolated_table_estimate(float32_t const input, interp_table_t const *table);
+
+/**
+ * @brief Initializes a cursor to walk a table object.
+ *
+ * A cursor remembers the last segment found, so consecutive lookups of slowly varying (or sorted) inputs
+ * start from it instead of searching the whole table.
+ *
+ * @param cursor The cursor object to be initialized.
+ * @param table The table object, shall be built and outlive the cursor.
+ * @return OK if successful, NOT_OK on invalid args.
+ */
+base_t interpolated_cursor_init(interp_cursor_t *cursor, interp_table_t const *table);
+
+/**
+ * @brief Estimates the output value based on the input and a cursor object.
+ *
+ * Same results as `interpolated_table_estimate`. The segment is searched from the last one found by
+ * galloping (steps of 1, 2, 4...) towards the input, O(1) for inputs on the same or a neighboring segment
+ * and O(log distance) on jumps.
+ *
+ * @param input The input value for which the output needs to be estimated.
+ * @param cursor The cursor object, updated with the segment found.
+ * @return The estimated output value, 0 if the cursor is not valid.
+ */
+float32_t interpolated_cursor_estimate(float32_t const input, interp_cursor_t *cursor);
+
+/**
+ * @brief Estimates the output values of an array of inputs based on a table object.
+ *
+ * Vectorized version of `interpolated_table_estimate`: the segment search, the gathers of the segment data
+ * and the evaluation are done on several inputs at once. The best kernel for the CPU is selected at runtime
+ * (AVX2 or SSE2 on x86, scalar otherwise) and the results are the same as the scalar estimation, including
+ * the LUT hits and the saturation at both ends of the table.
+ *
+ * @param inputs The array of input values.
+ * @param outputs The array for the estimated values (can be the inputs array, otherwise can't overlap).
+ * @param n The number of inputs.
+ * @param table The table object.
+ * @return OK if successful, NOT_OK on invalid args or table.
+ */
+base_t interpolated_estimate_n(float32_t const *inputs, float32_t *outputs, int32_t n,
+                               interp_table_t const *table);
+
+/**
+ * @brief Builds a fixed-point (Q15, int16_t samples) lookup table object from the given data points.
+ *
+ * The slope of every segment is precomputed as m / 2^shift, normalized so m keeps up to 31 significant
+ * bits whatever the steepness of the segment. The arrays are referenced, not copied.
+ *
+ * @param table The table object to be built.
+ * @param segs The storage for the length - 1 precomputed segments (can be NULL if length is 1).
+ * @param domain The array containing the sampled input data (x-axis), strictly increasing.
+ * @param range The array containing the sampled output data (y-axis).
+ * @param length The length of the input and output arrays.
+ * @return OK if successful, NOT_OK on invalid args or if the domain is not strictly increasing.
+ */
+base_t interpolated_q15_table_init(interp_q15_table_t *table, interp_qseg_t *segs, int16_t const *domain,
+                                   int16_t const *range, int32_t length);
+
+/**
+ * @brief Estimates the output value based on the input and a Q15 table object.
+ *
+ * Integer only version of `interpolated_table_estimate` (LUT hit, interpolation and saturation). The value
+ * is rounded to the nearest and saturated to the Q15 range, within 1 LSB of the exact interpolation.
+ *
+ * @param input The input value for which the output needs to be estimated.
+ * @param table The table object.
+ * @return The estimated output value, 0 if the table is not valid.
+ */
+int16_t interpolated_q15_estimate(int16_t const input, interp_q15_table_t const *table);
+
+/**
+ * @brief Estimates the output values of an array of inputs based on a Q15 table object.
+ *
+ * Each lookup gallops from the segment of the previous input, O(1) for slowly varying signals. The
+ * results are the same as `interpolated_q15_estimate`.
+ *
+ * @param inputs The array of input values.
+ * @param outputs The array for the estimated values (can be the inputs array, otherwise can't overlap).
+ * @param n The number of inputs.
+ * @param table The table object.
+ * @return OK if successful, NOT_OK on invalid args or table.
+ */
+base_t interpolated_q15_estimate_n(int16_t const *inputs, int16_t *outputs, int32_t n,
+                                   interp_q15_table_t const *table);
+
+/**
+ * @brief Builds a fixed-point (Q31, int32_t samples) lookup table object, see `interpolated_q15_table_init`.
+ */
+base_t interpolated_q31_table_init(interp_q31_table_t *table, interp_qseg_t *segs, int32_t const *domain,
+                                   int32_t const *range, int32_t length);
+
+/**
+ * @brief Estimates the output value based on the input and a Q31 table object, within 3 LSB of the exact
+ * interpolation. See `interpolated_q15_estimate`.
+ */
+int32_t interpolated_q31_estimate(int32_t const input, interp_q31_table_t const *table);
+
+/**
+ * @brief Estimates the output values of an array of inputs based on a Q31 table object. See
+ * `interpolated_q15_estimate_n`.
+ */
+base_t interpolated_q31_estimate_n(int32_t const *inputs, int32_t *outputs, int32_t n,
+                                   interp_q31_table_t const *table);
+
+/**
+ * @brief Builds a bank of tables sharing a domain.
+ *
+ * The samples, slopes and intercepts of the tables are stored in structure-of-arrays form (the data of all
+ * the tables at a segment is contiguous), so an input is searched once and every table is evaluated on the
+ * vector lanes.
+ *
+ * @param bank The bank object to be built.
+ * @param values The storage for the length * count samples.
+ * @param slopes The storage for the (length - 1) * count slopes.
+ * @param icepts The storage for the (length - 1) * count intercepts.
+ * @param domain The array containing the sampled input data (x-axis) of all the tables, strictly increasing.
+ * @param ranges The array of `count` arrays containing the sampled output data (y-axis) of each table.
+ * @param length The length of the domain and range arrays (length > 1).
+ * @param count The number of tables.
+ * @return OK if successful, NOT_OK on invalid args or if the domain is not strictly increasing.
+ */
+base_t interpolated_bank_init(interp_bank_t *bank, float32_t *values, float32_t *slopes, float32_t *icepts,
+                              float32_t const *domain, float32_t const *const *ranges, int32_t length,
+                              int32_t count);
+
+/**
+ * @brief Estimates the output value of every table of a bank for one input.
+ *
+ * Single segment search, then the tables are evaluated with SIMD (AVX2 or SSE2 selected at runtime,
+ * scalar otherwise). Same results as `interpolated_table_estimate` on each table, LUT hits and saturation
+ * included.
+ *
+ * @param input The input value for which the outputs need to be estimated.
+ * @param bank The bank object.
+ * @param outputs The array for the `count` estimated values, in the order of the ranges.
+ * @return OK if successful, NOT_OK on invalid args or bank.
+ */
+base_t interpolated_bank_estimate(float32_t const input, interp_bank_t const *bank, float32_t *outputs);
+
+/**
+ * @brief Resamples a table on a uniform grid with a bounded error.
+ *
+ * Irregular domains need a search, uniform ones compute the segment in O(1). The original (piecewise
+ * linear) table is resampled on the smallest uniform grid, up to `capacity` samples, whose max error to it
+ * is <= max_err. The grid keeps both ends of the domain, so the saturation is the same.
+ *
+ * @param table The table object to be built on the grid.
+ * @param grid_domain The storage for the domain of the grid, capacity samples.
+ * @param grid_range The storage for the range of the grid, capacity samples.
+ * @param segs The storage for the segments of the grid, capacity - 1 segments.
+ * @param capacity The max number of samples of the grid.
+ * @param domain The array containing the sampled input data (x-axis), strictly increasing.
+ * @param range The array containing the sampled output data (y-axis).
+ * @param length The length of the input and output arrays.
+ * @param max_err The max absolute error allowed.
+ * @param report The length, error and memory cost (bytes) of the grid, can be NULL.
+ * @return OK if successful, NOT_OK on invalid args or if the error can't be met within the capacity (the
+ *         table is then built on the largest grid and the report holds its error).
+ */
+base_t interpolated_resample(interp_table_t *table, float32_t *grid_domain, float32_t *grid_range,
+                             interp_seg_t *segs, int32_t capacity, float32_t const *domain,
+                             float32_t const *range, int32_t length, float32_t max_err,
+                             interp_resample_report_t *report);
+
+/**
+ * @brief Builds a cubic spline object from the given data points.
+ *
+ * The cubic of every segment is precomputed: a natural spline (C2, zero curvature at both ends) or a
+ * monotone PCHIP (C1, it doesn't overshoot between samples, monotone data gives a monotone curve). The
+ * arrays are referenced, not copied. The segment search is the one of the linear tables (O(1) on uniformly
+ * spaced domains).
+ *
+ * @param spline The spline object to be built.
+ * @param cubics The storage for the length - 1 cubics (can be NULL if length is 1).
+ * @param domain The array containing the sampled input data (x-axis), strictly increasing.
+ * @param range The array containing the sampled output data (y-axis).
+ * @param length The length of the input and output arrays.
+ * @param kind INTERP_SPLINE_NATURAL or INTERP_SPLINE_PCHIP.
+ * @return OK if successful, NOT_OK on invalid args or if the domain is not strictly increasing.
+ */
+base_t interpolated_spline_init(interp_spline_t *spline, interp_cubic_t *cubics, float32_t const *domain,
+                                float32_t const *range, int32_t length, interp_spline_kind_t kind);
+
+/**
+ * @brief Estimates the output value based on the input and a spline object.
+ *
+ * Same behavior as `interpolated_table_estimate` (LUT hit and saturation) with a cubic interpolation.
+ *
+ * @param input The input value for which the output needs to be estimated.
+ * @param spline The spline object.
+ * @return The estimated output value, 0 if the spline is not valid.
+ */
+float32_t interpolated_spline_estimate(float32_t const input, interp_spline_t const *spline);
+
+/**
+ * @brief Estimates the output values of an array of inputs based on a spline object.
+ *
+ * On irregular domains each lookup gallops from the segment of the previous input. The results are the
+ * same as `interpolated_spline_estimate`.
+ *
+ * @param inputs The array of input values.
+ * @param outputs The array for the estimated values (can be the inputs array, otherwise can't overlap).
+ * @param n The number of inputs.
+ * @param spline The spline object.
+ * @return OK if successful, NOT_OK on invalid args or spline.
+ */
+base_t interpolated_spline_estimate_n(float32_t const *inputs, float32_t *outputs, int32_t n,
+                                      interp_spline_t const *spline);
+
+/**
+ * @brief Builds a multi-dimensional map object (up to INTERP_MAP_MAX_DIMS axes).
+ *
+ * The values are referenced (not copied) and laid out contiguously in row-major order: the value of the
+ * breakpoints (i0, i1, ..., in) is at ((i0 * lengths[1] + i1) * lengths[2] + ...) + in.
+ *
+ * @param map The map object to be built.
+ * @param axes The breakpoints of each axis, strictly increasing.
+ * @param lengths The number of breakpoints of each axis.
+ * @param dims The number of axes.
+ * @param values The lengths[0] * ... * lengths[dims-1] values of the map.
+ * @return OK if successful, NOT_OK on invalid args or if an axis is not strictly increasing.
+ */
+base_t interpolated_map_init(interp_map_t *map, float32_t const *const *axes, int32_t const *lengths,
+                             int32_t dims, float32_t const *values);
+
+/**
+ * @brief Estimates the output value of a point based on a map object.
+ *
+ * Multilinear interpolation of the 2^dims corners of the cell holding the point (bilinear on 2D maps,
+ * trilinear on 3D maps). Every coordinate out of its axis saturates to the first or last breakpoint and
+ * the breakpoints are LUT hits, as the 1D estimation.
+ *
+ * @param input The coordinates of the point, one per axis.
+ * @param map The map object.
+ * @return The estimated output value, 0 if the map is not valid.
+ */
+float32_t interpolated_map_estimate(float32_t const *input, interp_map_t const *map);
+
+/**
+ * @brief Initializes a cursor to walk a map object, it caches the last segment found on each axis.
+ *
+ * @param cursor The cursor object to be initialized.
+ * @param map The map object, shall be built and outlive the cursor.
+ * @return OK if successful, NOT_OK on invalid args.
+ */
+base_t interpolated_map_cursor_init(interp_map_cursor_t *cursor, interp_map_t const *map);
+
+/**
+ * @brief Estimates the output value of a point based on a cursor object.
+ *
+ * Same results as `interpolated_map_estimate`, the search of every axis gallops from its cached segment.
+ *
+ * @param input The coordinates of the point, one per axis.
+ * @param cursor The cursor object, updated with the segments found.
+ * @return The estimated output value, 0 if the cursor is not valid.
+ */
+float32_t interpolated_map_cursor_estimate(float32_t const *input, interp_map_cursor_t *cursor);
+
+/**
+ * @brief Estimates the output values of an array of points based on a map object.
+ *
+ * Each point gallops from the segments of the previous one. The results are the same as
+ * `interpolated_map_estimate`.
+ *
+ * @param inputs The n points, dims coordinates each (n x dims, row-major).
+ * @param outputs The array for the n estimated values.
+ * @param n The number of points.
+ * @param map The map object.
+ * @return OK if successful, NOT_OK on invalid args or map.
+ */
+base_t interpolated_map_estimate_n(float32_t const *inputs, float32_t *outputs, int32_t n,
+                                   interp_map_t const *map);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* INTERPOLATE_H_ */
\ No newline at end of file
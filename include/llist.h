@@ -90,6 +90,16 @@ extern "C" {
  */
 #define LLIST_PUSH_FRONT(val, list) llist_push_head(&list, llist_create_node(&val, sizeof(val)))
 
+/**
+ * Description:
+ *   Provides the payloads of a compacted list as a read-only array of `type`, in traversal order.
+ *
+ * Usage:
+ *   llist_compact(&u8_list_head, sizeof(uint8_t), &u8_block);
+ *   uint8_t third = LLIST_BLOCK_DATA(uint8_t, u8_block)[2];
+ */
+#define LLIST_BLOCK_DATA(type, block) ((type const *)(block).data)
+
 /**
  * \brief    Creates a node for the linked list and fills it with the data provided
  * \param    data - to be copied into the node
@@ -99,6 +109,14 @@ extern "C" {
  */
 ll_node_ptr_t llist_create_node(void *data, uint32_t data_size);
 
+/**
+ * \brief    Creates a node for the linked list that takes the ownership of the data (no copy)
+ * \param    data - dynamically allocated data, it will be freed along with the node
+ * \return   the node created, NULL on error
+ * \todo
+ */
+ll_node_ptr_t llist_wrap_node(void *data);
+
 /**
  * \brief    Insert a node at the head of the list and updates the head
  * \param    head - reference (double pointer) to the head of the list, updated after the insertion
@@ -153,6 +171,54 @@ base_t llist_reversal(ll_handle_t *head);
  */
 uint32_t llist_get_size(ll_handle_t head);
 
+/**
+ * \brief    Returns the last node of the list
+ * \param    head - reference to the head of the list
+ * \return   the tail node, NULL if the list is empty
+ */
+ll_node_ptr_t llist_get_tail(ll_handle_t head);
+
+/**
+ * \brief    Appends all the nodes of `src` at the tail of the list, no data is copied or freed.
+ *           O(len head + len src) as both tails are walked, use `llist_splice` with known tails for O(1)
+ * \param    head - reference (double pointer) to the head of the list, updated if it was empty
+ * \param    src - reference (double pointer) to the head of the list to be moved, set to NULL
+ * \return   - OK if the nodes were moved, NOT_OK if `src` is empty
+ */
+base_t llist_concat(ll_handle_t *head, ll_handle_t *src);
+
+/**
+ * \brief    Splits the list in two, the nodes from position `pos` (0 is the head) onwards are moved to
+ *           `rest`. No data is copied or freed
+ * \param    head - reference (double pointer) to the head of the list, keeps the first `pos` nodes
+ * \param    pos - position of the first node to be moved
+ * \param    rest - reference (double pointer) to an empty list receiving the moved nodes
+ * \return   - OK if the list was split, NOT_OK if `rest` is not empty or `pos` is out of the list
+ */
+base_t llist_split_at(ll_handle_t *head, uint32_t pos, ll_handle_t *rest);
+
+/**
+ * \brief    Splits the list in two right before the first node for which the visitor returns other
+ *           than OK, that node and the following ones are moved to `rest`. No data is copied or freed
+ * \param    head - reference (double pointer) to the head of the list
+ * \param    vfn_ptr - predicate visitor, returning other than OK marks the split point
+ * \param    ctx - user context forwarded to the visitor
+ * \param    rest - reference (double pointer) to an empty list receiving the moved nodes
+ * \return   - OK if the list was split, NOT_OK if `rest` is not empty or no split point was found
+ */
+base_t llist_split_if(ll_handle_t *head, ll_visit_fn_t vfn_ptr, void *ctx, ll_handle_t *rest);
+
+/**
+ * \brief    Moves the range of nodes going from `*src_link` to `last` (inclusive) into the position
+ *           referenced by `dst_link`, in O(1). A link is either the head of a list or the `next`
+ *           member of a node. No data is copied or freed
+ * \param    dst_link - link where the range is inserted (e.g. &head or &tail->next), not within the range
+ * \param    src_link - link referencing the first node of the range, updated to the node after `last`
+ * \param    last - last node of the range, shall be reachable from `*src_link`
+ * \return   - OK if the range was moved, NOT_OK otherwise
+ */
+base_t llist_splice(ll_handle_t *dst_link, ll_handle_t *src_link, ll_node_ptr_t last);
+
 /**
  * \brief    Calls the function provided to perform an action on the data in the list, when the list ends
  *           or is empty it provides NULL to the function as notification.
@@ -161,6 +227,38 @@ uint32_t llist_get_size(ll_handle_t head);
  */
 void llist_traverse(ll_handle_t const head, void (*vfn_ptr)(void *));
 
+/**
+ * \brief    Calls the function provided with the data of every node and the user context until the
+ *           function returns other than OK. No NULL notification is sent at the end of the list.
+ *           The data of the next node and the node after it are prefetched while the function runs on
+ *           the current one.
+ * \param    head - reference to the head of the list
+ * \param    vfn_ptr - pointer to the visitor function
+ * \param    ctx - user context forwarded to the visitor
+ * \return   the node where the visitor stopped the traversal, NULL if the whole list was visited
+ */
+ll_node_ptr_t llist_traverse_ctx(ll_handle_t const head, ll_visit_fn_t vfn_ptr, void *ctx);
+
+/**
+ * \brief    Relocates the nodes and their data into a single allocation in traversal order and relinks
+ *           them, so a scan walks memory sequentially. The old nodes and data are freed. The compacted
+ *           nodes can be traversed, reversed or pushed to, but **shall not be popped**; release the list
+ *           with `llist_delete_compact`.
+ * \param    head - reference (double pointer) to the head of the list, updated to the compacted nodes
+ * \param    data_size - size of the data held by every node (all the nodes shall hold the same type)
+ * \param    block - in/out descriptor of the allocation, its `data` member is an array view of the data
+ * \return   - OK if the list was compacted, NOT_OK if empty or on allocation error (list untouched)
+ */
+base_t llist_compact(ll_handle_t *head, uint32_t data_size, ll_block_t *block);
+
+/**
+ * \brief    Deletes a compacted list, nodes pushed after the compaction are freed as well.
+ *           The head is set to NULL and the block is cleared
+ * \param    head - reference (double pointer) to the head of the list
+ * \param    block - descriptor filled by `llist_compact`
+ */
+void llist_delete_compact(ll_handle_t *head, ll_block_t *block);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file pqueue.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Priority queue (4-ary heap) public apis
+ *
+ */
+
+#ifndef PQUEUE_H_
+#define PQUEUE_H_
+
+// Includes
+#include "pqueue/pqueue_datatypes.h"
+#include "pqueue/pqueue_defines.h"
+
+/**
+ * Description:
+ *   Defines a global priority queue `pq` of a given type and length (size) on static storage, ordered by
+ *    `cmp` a `bool_t cmp(type const *a, type const *b)` function returning true when a shall be popped
+ *    before b. The type can be native data types or user-defined data types.
+ *
+ * Usage:
+ *   static bool_t min_first(uint32_t const *a, uint32_t const *b) { return *a < *b; }
+ *   PQUEUE_CREATE(uint32_t, deadlines, 64, min_first);
+ *   PQUEUE_CREATE(struct job, jobs, 10, job_cmp);
+ */
+#define PQUEUE_CREATE(type, pq, length, cmp) _PQUEUE_DEF_TYPE(type, pq, length, cmp)
+
+/**
+ * Description:
+ *   Resets the priority queue, putting it in a known (default) state.
+ *   Note: Does not clean the freed slots.
+ */
+#define PQUEUE_FLUSH(pq) \
+  do {                   \
+    pq.u16_count = 0;    \
+  } while (0)
+
+/**
+ * Description:
+ *   Inserts the element pointed to by `elem` in the priority queue `pq`, O(log n).
+ *   After the write, the occupancy count increases by one.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Out of space
+ */
+#define PQUEUE_PUSH(pq, elem) pq##_push_refd(elem)
+
+/**
+ * Description:
+ *   Removes the first (highest priority) element of the priority queue `pq` and makes it available
+ *   at `elem`, O(log n). The occupancy count reduces by one.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Empty
+ */
+#define PQUEUE_POP(pq, elem) pq##_pop_refd(elem)
+
+/**
+ * Description:
+ *   Copies the first (highest priority) element of the priority queue `pq` into the location pointed
+ *   to by `elem`. This method is read-only and does not affects the occupancy status.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Empty
+ */
+#define PQUEUE_TOP(pq, elem) pq##_top_refd(elem)
+
+/**
+ * Description:
+ *   Inserts the `count` elements of the array `elems` in the priority queue `pq` at once, the heap is
+ *   rebuilt bottom-up in O(n) instead of O(count log n) of pushing them one by one.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Out of space, none is inserted
+ */
+#define PQUEUE_HEAPIFY(pq, elems, count) pq##_heapify_refd(elems, count)
+
+/**
+ * Description:
+ *   Returns the number of free slots in the priority queue `pq`.
+ *
+ * Returns (int):
+ *   0..N - Number of slots available.
+ */
+#define PQUEUE_SPACES(pq) (pq.u16_lgth - pqueue_size(&pq))
+
+typedef pqueue_t *pqueue_handle_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief    Initializes the priority queue
+ * \param    pq - priority queue handle to assign the
+ * \param    buffer reference, it shall hold length + 1 elements (the last one is the sift scratch), its
+ * \param    length or capacity of the queue (maximum number of elements), size of each
+ * \param    element_sz in the buffer and the
+ * \param    cmp function returning true when its first element shall be popped before the second
+ * \return   OK if successful, NOT_OK otherwise.
+ */
+base_t pqueue_init(pqueue_handle_t pq, void *const buffer, uint16_t const length, uint16_t const element_sz,
+                   pq_cmp_fn_t const cmp);
+
+/**
+ * \brief    Resets the priority queue, putting it in a known state
+ * \param    pq - priority queue to be reset
+ * \return   OK if successful, NOT_OK otherwise.
+ */
+base_t pqueue_reset(pqueue_handle_t pq);
+
+/**
+ * \brief    Inserts new data into the priority queue, O(log n)
+ * \param    pq - priority queue handle to add the
+ * \param    element sifted up to its place
+ * \return   OK if successful, NOT_OK otherwise (full)
+ */
+base_t pqueue_push(pqueue_handle_t pq, void *const element);
+
+/**
+ * \brief    Retrieves the first (highest priority) data from the priority queue, O(log n)
+ * \param    pq - priority queue handle to retrieve the
+ * \param    element from its root, if
+ * \param    rd_only a read will be performed but the data will be retained in the queue
+ * \return   OK if successful, NOT_OK otherwise (empty)
+ */
+base_t pqueue_pop(pqueue_handle_t pq, void *element, bool_t const rd_only);
+
+/**
+ * \brief    Inserts many data at once, rebuilding the heap bottom-up (Floyd) in O(n)
+ * \param    pq - priority queue handle to add the
+ * \param    elements array of
+ * \param    count elements
+ * \return   OK if successful, NOT_OK otherwise (not enough space, none is inserted)
+ */
+base_t pqueue_heapify(pqueue_handle_t pq, void *const elements, uint16_t const count);
+
+/**
+ * \brief    Provides the current number of elements in the priority queue.
+ * \param    pq - priority queue to get its current
+ * \return   size (number of elements), 0 if empty or NULL is provided
+ */
+uint16_t pqueue_size(pqueue_handle_t pq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PQUEUE_H_ */
\ No newline at end of file
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file sklist.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Skip list API (ordered index with O(log n) expected search)
+ *
+ */
+
+#ifndef SKLIST_H_
+#define SKLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Includes
+#include "sklist_datatypes.h"
+#include "sklist_defines.h"
+
+/**
+ * Description:
+ *   Defines globally a skip list of a given type plus the typed helpers to search and remove by key.
+ *    The type can be native data types or user-defined data types.
+ *
+ * Usage:
+ *   SKLIST_TYPE_CREATE(struct foo, foo_index);
+ *   SKLIST_INSERT(42, foo, foo_index);
+ *   SKLIST_SEARCH_REF(foo_index, 42, &foo);
+ *   SKLIST_REMOVE_REF(foo_index, 42, &foo);
+ */
+#define SKLIST_TYPE_CREATE(type, list) _SKLIST_DEF_TYPE(type, list)
+
+/**
+ * Description:
+ *   Inserts a copy of the value holded by `val` into the skip list ordered by `key`.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Error or `key` already present
+ */
+#define SKLIST_INSERT(key, val, list) sklist_insert(&list, key, &val, sizeof(val))
+
+/**
+ * Description:
+ *   Copies the data stored under `key` into the in/out reference, the node is retained.
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Not found
+ */
+#define SKLIST_SEARCH_REF(list, key, ref) sklist_search_refd_##list((&list), key, ref)
+
+/**
+ * Description:
+ *   Removes the node stored under `key` and provides the data in/out reference
+ *
+ * Returns (base_t):
+ *   0 - Success
+ *   1 - Not found
+ */
+#define SKLIST_REMOVE_REF(list, key, ref) sklist_remove_refd_##list((&list), key, ref)
+
+/**
+ * \brief    Inserts a copy of the data into the list keeping the keys in ascending order
+ * \param    sl - skip list handle
+ * \param    key - ordering key, must be unique within the list
+ * \param    data - to be copied into the node
+ * \param    data_size - to be allocated in the node
+ * \return   OK if the insertion was successful, NOT_OK on allocation error or duplicated key
+ */
+base_t sklist_insert(sk_handle_t sl, sk_key_t key, void *data, uint32_t data_size);
+
+/**
+ * \brief    Finds the data stored under the key
+ * \param    sl - skip list handle
+ * \param    key - to look up
+ * \return   a reference to the data owned by the list, NULL if not found
+ */
+void *sklist_search(sk_handle_t sl, sk_key_t key);
+
+/**
+ * \brief    Removes the node stored under the key
+ * \param    sl - skip list handle
+ * \param    key - to be removed
+ * \param    data - reference to the data retrieved. **Must be freed by user**. If NULL the data is freed
+ * \return   OK if the key was found and removed, NOT_OK otherwise
+ */
+base_t sklist_remove(sk_handle_t sl, sk_key_t key, void **data);
+
+/**
+ * \brief    Calls the function provided for every node with lo <= key <= hi in ascending key order
+ * \param    sl - skip list handle
+ * \param    lo - lower bound of the range (inclusive)
+ * \param    hi - upper bound of the range (inclusive)
+ * \param    vfn_ptr - visitor, returning other than OK stops the iteration
+ * \param    ctx - user context forwarded to the visitor
+ * \return   the number of nodes visited
+ */
+uint32_t sklist_range(sk_handle_t sl, sk_key_t lo, sk_key_t hi, sk_visit_fn_t vfn_ptr, void *ctx);
+
+/**
+ * \brief    Returns the number of nodes in the list
+ * \param    sl - skip list handle
+ * \return   the size of the list
+ */
+uint32_t sklist_get_size(sk_handle_t sl);
+
+/**
+ * \brief    Deletes all the nodes and frees the memory, the list is left empty and reusable
+ * \param    sl - skip list handle
+ */
+void sklist_delete_list(sk_handle_t sl);
+
+/**
+ * \brief    Creates a skip list safe to be shared between threads. Lookups are lock-free, insert and
+ *           remove only lock the predecessors of the affected node (lazy skip list)
+ * \return   the handle created, NULL on allocation error
+ */
+sk_chandle_t sklist_conc_create(void);
+
+/**
+ * \brief    Inserts a copy of the data into the concurrent list
+ * \param    sl - concurrent skip list handle
+ * \param    key - ordering key, must be unique within the list
+ * \param    data - to be copied into the node
+ * \param    data_size - to be allocated in the node
+ * \return   OK if the insertion was successful, NOT_OK on allocation error or duplicated key
+ */
+base_t sklist_conc_insert(sk_chandle_t sl, sk_key_t key, void *data, uint32_t data_size);
+
+/**
+ * \brief    Finds the data stored under the key (lock-free)
+ * \param    sl - concurrent skip list handle
+ * \param    key - to look up
+ * \return   a reference to the data owned by the list, valid until the next `sklist_conc_reclaim`.
+ *           NULL if not found
+ */
+void *sklist_conc_search(sk_chandle_t sl, sk_key_t key);
+
+/**
+ * \brief    Removes the node stored under the key. The node is retired, not freed, since concurrent
+ *           readers could still be walking through it
+ * \param    sl - concurrent skip list handle
+ * \param    key - to be removed
+ * \return   OK if the key was found and removed, NOT_OK otherwise
+ */
+base_t sklist_conc_remove(sk_chandle_t sl, sk_key_t key);
+
+/**
+ * \brief    Calls the function provided for every live node with lo <= key <= hi in ascending key order.
+ *           Concurrent updates may or may not be observed
+ * \param    sl - concurrent skip list handle
+ * \param    lo - lower bound of the range (inclusive)
+ * \param    hi - upper bound of the range (inclusive)
+ * \param    vfn_ptr - visitor, returning other than OK stops the iteration
+ * \param    ctx - user context forwarded to the visitor
+ * \return   the number of nodes visited
+ */
+uint32_t sklist_conc_range(sk_chandle_t sl, sk_key_t lo, sk_key_t hi, sk_visit_fn_t vfn_ptr, void *ctx);
+
+/**
+ * \brief    Returns the number of live nodes in the concurrent list
+ * \param    sl - concurrent skip list handle
+ * \return   the size of the list
+ */
+uint32_t sklist_conc_get_size(sk_chandle_t sl);
+
+/**
+ * \brief    Frees the nodes retired by `sklist_conc_remove`. Must be called at a quiescent point, when no
+ *           other thread is accessing the list
+ * \param    sl - concurrent skip list handle
+ */
+void sklist_conc_reclaim(sk_chandle_t sl);
+
+/**
+ * \brief    Deletes the concurrent list and frees the memory, the handle is set to NULL
+ * \param    sl - reference to the concurrent skip list handle
+ */
+void sklist_conc_destroy(sk_chandle_t *sl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SKLIST_H_ */
@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file twheel.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Hierarchical Timing Wheel public apis
+ *
+ */
+
+#ifndef TWHEEL_H_
+#define TWHEEL_H_
+
+// Includes
+#include "twheel/twheel_datatypes.h"
+#include "twheel/twheel_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Description:
+ *   Defines a global timing wheel object `wheel` starting at tick 0, ready to be used (no init needed).
+ *    The timers are embedded by the user in its own data, the wheel doesn't allocate.
+ *
+ * Usage:
+ *   TWHEEL_CREATE(conn_timeouts);
+ *   twheel_timer_init(&conn->timeout, on_conn_timeout, conn);
+ *   twheel_add(&conn_timeouts, &conn->timeout, 30 * TICKS_PER_SEC);
+ *   ...
+ *   twheel_advance(&conn_timeouts, elapsed_ticks); // From the periodic tick
+ */
+#define TWHEEL_CREATE(wheel) _TWHEEL_DEF_WHEEL(wheel)
+
+/**
+ * @brief Initializes (empties) a timing wheel.
+ *
+ * @param wheel The wheel object to be initialized.
+ * @param now The current tick.
+ * @return OK if successful, NOT_OK on invalid args.
+ */
+base_t twheel_init(twheel_t *wheel, uint64_t now);
+
+/**
+ * @brief Initializes a timer, not pending on any wheel.
+ *
+ * @param timer The timer object to be initialized.
+ * @param fn The callback called on the expiration.
+ * @param ctx The user context passed to the callback.
+ * @return OK if successful, NOT_OK on invalid args.
+ */
+base_t twheel_timer_init(tw_timer_t *timer, tw_expire_fn_t fn, void *ctx);
+
+/**
+ * @brief Adds (or re-arms) a timer to expire `delay` ticks from the current tick, O(1).
+ *
+ * A pending timer is moved to the new expiration. A delay of 0 expires on the next tick and delays longer
+ * than the wheel range (64^TWHEEL_LEVELS - 1 ticks) are clamped to it.
+ *
+ * @param wheel The wheel object.
+ * @param timer The initialized timer object, shall outlive its pending time.
+ * @param delay The ticks until the expiration.
+ * @return OK if successful, NOT_OK on invalid args.
+ */
+base_t twheel_add(twheel_t *wheel, tw_timer_t *timer, uint64_t delay);
+
+/**
+ * @brief Cancels a pending timer, O(1). The callback is not called.
+ *
+ * @param timer The timer object.
+ * @return OK if the timer was pending, NOT_OK otherwise.
+ */
+base_t twheel_cancel(tw_timer_t *timer);
+
+/**
+ * @brief Checks if a timer is pending on a wheel.
+ *
+ * @param timer The timer object.
+ * @return true if the timer is pending (added and not expired or cancelled).
+ */
+bool_t twheel_pending(tw_timer_t const *timer);
+
+/**
+ * @brief Advances the wheel a number of ticks and calls the callbacks of the expired timers.
+ *
+ * The timers of a tick are taken out of the wheel as a batch before their callbacks run, which can add or
+ * cancel any timer. Empty ticks of the first level are skipped, the timers of the upper levels are cascaded
+ * down only when the first level wraps (lazily), and an empty wheel just moves the current tick.
+ *
+ * @param wheel The wheel object.
+ * @param ticks The ticks elapsed.
+ * @return The number of expired timers.
+ */
+uint32_t twheel_advance(twheel_t *wheel, uint64_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TWHEEL_H_ */
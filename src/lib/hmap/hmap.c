@@ -0,0 +1,348 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file hmap.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the open addressing Hash map implementation
+ *
+ * Every slot has a control byte: EMPTY, DELETED or FULL plus 7 bits of the key hash (h2). The rest of
+ * the hash (h1) selects the first group of HMAP_GROUP_WIDTH slots to probe; a whole group of control
+ * bytes is compared against h2 at once (SSE2, or SWAR on 64-bit words) so the keys are only compared on
+ * a probable hit. The probe sequence jumps between groups (triangular) and stops at a group with an
+ * EMPTY slot.
+ *
+ * @see https://abseil.io/about/design/swisstables
+ */
+
+#include "hmap.h"
+#include <string.h> // memcpy, memcmp, memset
+
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+
+  #define HMAP_MASK_SHIFT (0U) // A bit per slot
+
+static inline uint64_t hmap_group_match(uint8_t const *group, uint8_t const h) {
+  __m128i const ctrl = _mm_loadu_si128((__m128i const *)group);
+  return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h)));
+}
+
+static inline uint64_t hmap_group_match_empty(uint8_t const *group) {
+  return hmap_group_match(group, HMAP_CTRL_EMPTY);
+}
+
+static inline uint64_t hmap_group_match_free(uint8_t const *group) {
+  __m128i const ctrl = _mm_loadu_si128((__m128i const *)group);
+  return (~(uint32_t)_mm_movemask_epi8(ctrl)) & 0xFFFFU; // EMPTY or DELETED, MSB clear
+}
+#else
+  #define HMAP_MASK_SHIFT (3U) // A byte per slot, the flag is its MSB
+  #define HMAP_LSBS       (0x0101010101010101ULL)
+  #define HMAP_MSBS       (0x8080808080808080ULL)
+  #define HMAP_LOW7       (0x7F7F7F7F7F7F7F7FULL)
+
+static inline uint64_t hmap_group_load(uint8_t const *group) {
+  uint64_t word;
+  (void)memcpy(&word, group, sizeof(word));
+  #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  word = __builtin_bswap64(word);
+  #endif
+  return word;
+}
+
+/* Exact zero byte detection, the MSB of every zero byte is set */
+static inline uint64_t hmap_zero_bytes(uint64_t const x) {
+  return ~(((x & HMAP_LOW7) + HMAP_LOW7) | x | HMAP_LOW7);
+}
+
+static inline uint64_t hmap_group_match(uint8_t const *group, uint8_t const h) {
+  return hmap_zero_bytes(hmap_group_load(group) ^ (HMAP_LSBS * h));
+}
+
+static inline uint64_t hmap_group_match_empty(uint8_t const *group) {
+  return hmap_zero_bytes(hmap_group_load(group));
+}
+
+static inline uint64_t hmap_group_match_free(uint8_t const *group) {
+  return ~hmap_group_load(group) & HMAP_MSBS; // EMPTY or DELETED, MSB clear
+}
+#endif
+
+#define HMAP_MASK_FIRST(mask) ((uint32_t)__builtin_ctzll(mask) >> HMAP_MASK_SHIFT)
+
+static inline uint64_t hmap_mix(uint64_t k) {
+  k ^= k >> 33;
+  k *= 0xFF51AFD7ED558CCDULL;
+  k ^= k >> 33;
+  k *= 0xC4CEB9FE1A85EC53ULL;
+  k ^= k >> 33;
+  return k;
+}
+
+uint64_t hmap_hash_bytes(void const *key, uint32_t len) {
+  uint8_t const *bytes = (uint8_t const *)key;
+  uint64_t       h     = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)len * 0xFF51AFD7ED558CCDULL);
+  uint64_t       word  = 0U;
+
+  for (; len >= sizeof(word); len -= sizeof(word), bytes += sizeof(word)) {
+    (void)memcpy(&word, bytes, sizeof(word));
+    h = (h ^ hmap_mix(word)) * 0x9E3779B97F4A7C15ULL;
+  }
+  if (0U != len) {
+    word = 0U;
+    (void)memcpy(&word, bytes, len);
+    h = (h ^ hmap_mix(word)) * 0x9E3779B97F4A7C15ULL;
+  }
+
+  return hmap_mix(h);
+}
+
+static inline uint8_t *hmap_slot(hmap_handle_t map, uint32_t const idx) {
+  return (uint8_t *)map->vSlots + ((size_t)idx * map->u16_sSize);
+}
+
+/* Returns the slot holding the key or -1, the first free slot on the probe sequence is provided as well */
+static int64_t hmap_probe(hmap_handle_t map, void const *key, uint64_t const hash, int64_t *free_slot) {
+  uint32_t const groups = map->u32_cap / HMAP_GROUP_WIDTH;
+  uint32_t       group  = (uint32_t)(hash >> 7) & (groups - 1U);
+  uint8_t const  h2     = HMAP_CTRL_FULL | (uint8_t)(hash & 0x7FU);
+
+  if (NULL != free_slot) *free_slot = -1;
+
+  for (uint32_t step = 0U; step < groups;) {
+    uint32_t const base  = group * HMAP_GROUP_WIDTH;
+    uint8_t const *ctrl  = &map->u8_ctrl[base];
+    uint64_t       match = hmap_group_match(ctrl, h2);
+
+    while (0U != match) {
+      uint32_t const idx = base + HMAP_MASK_FIRST(match);
+      if (0 == memcmp(hmap_slot(map, idx), key, map->u16_kSize)) return (int64_t)idx;
+      match &= match - 1U;
+    }
+
+    if ((NULL != free_slot) && (-1 == *free_slot)) {
+      uint64_t const avail = hmap_group_match_free(ctrl);
+      if (0U != avail) *free_slot = (int64_t)(base + HMAP_MASK_FIRST(avail));
+    }
+
+    if (0U != hmap_group_match_empty(ctrl)) break; // The key was never pushed past this group
+
+    group = (group + ++step) & (groups - 1U);
+  }
+
+  return -1;
+}
+
+/* Group of the first free (EMPTY or DELETED) slot on the probe sequence of hash */
+static uint32_t hmap_first_free(hmap_handle_t map, uint64_t const hash, uint32_t *idx) {
+  uint32_t const groups = map->u32_cap / HMAP_GROUP_WIDTH;
+  uint32_t       group  = (uint32_t)(hash >> 7) & (groups - 1U);
+  uint64_t       avail  = hmap_group_match_free(&map->u8_ctrl[group * HMAP_GROUP_WIDTH]);
+
+  for (uint32_t step = 0U; 0U == avail;) {
+    group = (group + ++step) & (groups - 1U);
+    avail = hmap_group_match_free(&map->u8_ctrl[group * HMAP_GROUP_WIDTH]);
+  }
+  *idx = (group * HMAP_GROUP_WIDTH) + HMAP_MASK_FIRST(avail);
+  return group;
+}
+
+static void hmap_swap_slots(hmap_handle_t map, uint32_t const a, uint32_t const b) {
+  uint8_t *pa = hmap_slot(map, a);
+  uint8_t *pb = hmap_slot(map, b);
+
+  for (uint32_t i = 0U; i < map->u16_sSize; ++i) {
+    uint8_t const tmp = pa[i];
+    pa[i]             = pb[i];
+    pb[i]             = tmp;
+  }
+}
+
+/* Rehashes in place dropping the tombstones, the storage can't grow. Every FULL slot is marked DELETED
+ * (pending) and every tombstone EMPTY, then each pending key goes to the first free slot of its probe
+ * sequence: it stays if that slot is on its own group, it's moved to an EMPTY one or it's swapped with
+ * a pending one, which is rehashed next. A group holding a pending slot is not full, so no key placed
+ * before goes through it. */
+static void hmap_drop_tombs(hmap_handle_t map) {
+  for (uint32_t idx = 0U; idx < map->u32_cap; ++idx) {
+    map->u8_ctrl[idx] = (map->u8_ctrl[idx] & HMAP_CTRL_FULL) ? HMAP_CTRL_DELETED : HMAP_CTRL_EMPTY;
+  }
+
+  for (uint32_t idx = 0U; idx < map->u32_cap;) {
+    if (HMAP_CTRL_DELETED != map->u8_ctrl[idx]) {
+      ++idx;
+    } else {
+      uint64_t const hash   = hmap_hash_bytes(hmap_slot(map, idx), map->u16_kSize);
+      uint8_t const  h2     = HMAP_CTRL_FULL | (uint8_t)(hash & 0x7FU);
+      uint32_t       target = 0U;
+
+      if (hmap_first_free(map, hash, &target) == (idx / HMAP_GROUP_WIDTH)) {
+        map->u8_ctrl[idx++] = h2;
+      } else if (HMAP_CTRL_EMPTY == map->u8_ctrl[target]) {
+        (void)memcpy(hmap_slot(map, target), hmap_slot(map, idx), map->u16_sSize);
+        map->u8_ctrl[target] = h2;
+        map->u8_ctrl[idx++]  = HMAP_CTRL_EMPTY;
+      } else {
+        hmap_swap_slots(map, idx, target); // idx holds the other pending key now
+        map->u8_ctrl[target] = h2;
+      }
+    }
+  }
+  map->u32_tombs = 0U;
+}
+
+base_t hmap_init(hmap_handle_t map, uint8_t *const ctrl, void *const slots, uint32_t const capacity,
+                 uint16_t const key_sz, uint16_t const slot_sz, uint16_t const val_offs,
+                 uint16_t const val_sz) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != map) && (NULL != ctrl) && (NULL != slots) && (16U <= capacity) &&
+      (0U == (capacity & (capacity - 1U))) && (key_sz) && (key_sz <= val_offs) && (val_sz) &&
+      ((uint32_t)val_offs + val_sz <= slot_sz)) {
+    uint8_t **ctrl_ref  = (uint8_t **)&map->u8_ctrl;
+    void    **slots_ref = (void **)&map->vSlots;
+    uint16_t *k_size    = (uint16_t *)&map->u16_kSize;
+    uint16_t *s_size    = (uint16_t *)&map->u16_sSize;
+    uint16_t *v_offs    = (uint16_t *)&map->u16_vOffs;
+    uint16_t *v_size    = (uint16_t *)&map->u16_vSize;
+    uint32_t *cap       = (uint32_t *)&map->u32_cap;
+
+    // assignation of the members through pointers
+    *ctrl_ref  = ctrl;
+    *slots_ref = slots;
+    *k_size    = key_sz;
+    *s_size    = slot_sz;
+    *v_offs    = val_offs;
+    *v_size    = val_sz;
+    *cap       = capacity;
+    ret_val    = hmap_reset(map);
+  }
+  return ret_val;
+}
+
+base_t hmap_reset(hmap_handle_t map) {
+  base_t ret_val = NOT_OK;
+
+  if (NULL != map) {
+    (void)memset(map->u8_ctrl, HMAP_CTRL_EMPTY, map->u32_cap);
+    map->u32_size  = 0U;
+    map->u32_tombs = 0U;
+    ret_val        = OK;
+  }
+  return ret_val;
+}
+
+base_t hmap_put(hmap_handle_t map, void const *key, void const *val) {
+  base_t ret_val = OK;
+
+  if ((NULL == map) || (NULL == key) || (NULL == val)) {
+    ret_val = NOT_OK;
+  } else {
+    uint64_t const hash      = hmap_hash_bytes(key, map->u16_kSize);
+    int64_t        free_slot = -1;
+    int64_t        found     = hmap_probe(map, key, hash, &free_slot);
+    // Keeps at least 1/8 of the slots EMPTY so every probe sequence ends
+    uint32_t const limit = map->u32_cap - (map->u32_cap >> 3);
+
+    if ((-1 == found) && (-1 != free_slot) && (HMAP_CTRL_EMPTY == map->u8_ctrl[free_slot]) &&
+        (0U != map->u32_tombs) && (limit <= (map->u32_size + map->u32_tombs)) && (map->u32_size < limit)) {
+      // The tombstones take the room left, they are dropped instead of refusing the key
+      hmap_drop_tombs(map);
+      found = hmap_probe(map, key, hash, &free_slot);
+    }
+
+    if (-1 != found) {
+      uint8_t *slot = hmap_slot(map, (uint32_t)found);
+      (void)memcpy(slot + map->u16_vOffs, val, map->u16_vSize);
+    } else if ((-1 == free_slot) || ((HMAP_CTRL_EMPTY == map->u8_ctrl[free_slot]) &&
+                                     (limit <= (map->u32_size + map->u32_tombs)))) {
+      ret_val = BUSY_W;
+    } else {
+      uint8_t *slot = hmap_slot(map, (uint32_t)free_slot);
+
+      if (HMAP_CTRL_DELETED == map->u8_ctrl[free_slot]) --map->u32_tombs;
+      map->u8_ctrl[free_slot] = HMAP_CTRL_FULL | (uint8_t)(hash & 0x7FU);
+      (void)memcpy(slot, key, map->u16_kSize);
+      (void)memcpy(slot + map->u16_vOffs, val, map->u16_vSize);
+      ++map->u32_size;
+    }
+  }
+
+  return ret_val;
+}
+
+void *hmap_find(hmap_handle_t map, void const *key) {
+  void *val = NULL;
+
+  if ((NULL != map) && (NULL != key) && (0U != map->u32_size)) {
+    int64_t const found = hmap_probe(map, key, hmap_hash_bytes(key, map->u16_kSize), NULL);
+
+    if (-1 != found) val = hmap_slot(map, (uint32_t)found) + map->u16_vOffs;
+  }
+
+  return val;
+}
+
+base_t hmap_get(hmap_handle_t map, void const *key, void *val) {
+  base_t      ret_val = NOT_OK;
+  void *const found   = hmap_find(map, key);
+
+  if ((NULL != found) && (NULL != val)) {
+    (void)memcpy(val, found, map->u16_vSize);
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
+
+base_t hmap_remove(hmap_handle_t map, void const *key) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != map) && (NULL != key) && (0U != map->u32_size)) {
+    int64_t const found = hmap_probe(map, key, hmap_hash_bytes(key, map->u16_kSize), NULL);
+
+    if (-1 != found) {
+      uint32_t const base = (uint32_t)found & ~(HMAP_GROUP_WIDTH - 1U);
+
+      /* A group that still has an EMPTY slot has never been full, so no probe sequence went through it
+       * and the slot can be EMPTY again. Otherwise it must be a tombstone */
+      if (0U != hmap_group_match_empty(&map->u8_ctrl[base])) {
+        map->u8_ctrl[found] = HMAP_CTRL_EMPTY;
+      } else {
+        map->u8_ctrl[found] = HMAP_CTRL_DELETED;
+        ++map->u32_tombs;
+      }
+      --map->u32_size;
+      ret_val = OK;
+    }
+  }
+
+  return ret_val;
+}
+
+uint32_t hmap_size(hmap_handle_t map) {
+  return (NULL != map) ? map->u32_size : 0U;
+}
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file hmap_chain.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the separate chaining Hash map implementation
+ *
+ * Every bucket is a `llist`, each node holds a single allocation with the key followed by the value.
+ */
+
+#include "hmap.h"
+#include "llist.h"
+#include <stdlib.h> // malloc, free
+#include <string.h> // memcpy, memcmp
+
+static inline ll_handle_t *hmap_chain_bucket(hmap_chain_handle_t map, void const *key) {
+  return &map->pBuckets[hmap_hash_bytes(key, map->u16_kSize) & (map->u32_nBkts - 1U)];
+}
+
+/* Returns the link (within the bucket) pointing to the node holding the key, NULL if not found */
+static ll_handle_t *hmap_chain_lookup(hmap_chain_handle_t map, ll_handle_t *link, void const *key) {
+  while (NULL != *link) {
+    if (0 == memcmp((*link)->data, key, map->u16_kSize)) return link;
+    link = &(*link)->next;
+  }
+
+  return NULL;
+}
+
+base_t hmap_chain_init(hmap_chain_handle_t map, ll_handle_t *const buckets, uint32_t const n_buckets,
+                       uint16_t const key_sz, uint32_t const val_offs, uint32_t const val_sz) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != map) && (NULL != buckets) && (n_buckets) && (0U == (n_buckets & (n_buckets - 1U))) &&
+      (key_sz) && (key_sz <= val_offs) && (val_sz)) {
+    ll_handle_t **bkts_ref = (ll_handle_t **)&map->pBuckets;
+    uint16_t     *k_size   = (uint16_t *)&map->u16_kSize;
+    uint32_t     *v_offs   = (uint32_t *)&map->u32_vOffs;
+    uint32_t     *v_size   = (uint32_t *)&map->u32_vSize;
+    uint32_t     *n_bkts   = (uint32_t *)&map->u32_nBkts;
+
+    // assignation of the members through pointers
+    *bkts_ref = buckets;
+    *k_size   = key_sz;
+    *v_offs   = val_offs;
+    *v_size   = val_sz;
+    *n_bkts   = n_buckets;
+
+    for (uint32_t i = 0U; i < n_buckets; ++i) {
+      buckets[i] = NULL;
+    }
+    map->u32_size = 0U;
+    ret_val       = OK;
+  }
+  return ret_val;
+}
+
+base_t hmap_chain_put(hmap_chain_handle_t map, void const *key, void const *val) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != map) && (NULL != key) && (NULL != val)) {
+    ll_handle_t *bucket = hmap_chain_bucket(map, key);
+    ll_handle_t *link   = hmap_chain_lookup(map, bucket, key);
+
+    if (NULL != link) {
+      (void)memcpy((uint8_t *)(*link)->data + map->u32_vOffs, val, map->u32_vSize);
+      ret_val = OK;
+    } else {
+      uint8_t *entry = (uint8_t *)malloc(map->u32_vOffs + map->u32_vSize);
+
+      if (NULL != entry) {
+        (void)memcpy(entry, key, map->u16_kSize);
+        (void)memcpy(entry + map->u32_vOffs, val, map->u32_vSize);
+        ret_val = llist_push_head(bucket, llist_wrap_node(entry));
+
+        if (OK == ret_val) {
+          ++map->u32_size;
+        } else {
+          free(entry);
+        }
+      }
+    }
+  }
+
+  return ret_val;
+}
+
+void *hmap_chain_find(hmap_chain_handle_t map, void const *key) {
+  void *val = NULL;
+
+  if ((NULL != map) && (NULL != key)) {
+    ll_handle_t *link = hmap_chain_lookup(map, hmap_chain_bucket(map, key), key);
+
+    if (NULL != link) val = (uint8_t *)(*link)->data + map->u32_vOffs;
+  }
+
+  return val;
+}
+
+base_t hmap_chain_get(hmap_chain_handle_t map, void const *key, void *val) {
+  base_t      ret_val = NOT_OK;
+  void *const found   = hmap_chain_find(map, key);
+
+  if ((NULL != found) && (NULL != val)) {
+    (void)memcpy(val, found, map->u32_vSize);
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
+
+base_t hmap_chain_remove(hmap_chain_handle_t map, void const *key) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != map) && (NULL != key)) {
+    ll_handle_t *link = hmap_chain_lookup(map, hmap_chain_bucket(map, key), key);
+
+    if (NULL != link) {
+      // The link is the head of the remaining chain
+      free(llist_pop_head_data(link));
+      --map->u32_size;
+      ret_val = OK;
+    }
+  }
+
+  return ret_val;
+}
+
+uint32_t hmap_chain_size(hmap_chain_handle_t map) {
+  return (NULL != map) ? map->u32_size : 0U;
+}
+
+void hmap_chain_delete(hmap_chain_handle_t map) {
+  if (NULL != map) {
+    for (uint32_t i = 0U; i < map->u32_nBkts; ++i) {
+      llist_delete_list(&map->pBuckets[i]);
+    }
+    map->u32_size = 0U;
+  }
+}
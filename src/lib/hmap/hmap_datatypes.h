@@ -0,0 +1,63 @@
+/**
+ * @file hmap_datatypes.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Hash map datatypes definition
+ *
+ */
+
+#ifndef HMAP_DATATYPES_H_
+#define HMAP_DATATYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Includes
+#include "llist_datatypes.h"
+#include "utils_common.h"
+
+/* Control bytes, zero is EMPTY so statically allocated maps start empty */
+#define HMAP_CTRL_EMPTY   (0x00U)
+#define HMAP_CTRL_DELETED (0x01U)
+#define HMAP_CTRL_FULL    (0x80U) // OR'ed with the 7 bits (h2) of the hash
+
+/* Number of control bytes probed at once */
+#if defined(__SSE2__)
+  #define HMAP_GROUP_WIDTH (16U)
+#else
+  #define HMAP_GROUP_WIDTH (8U)
+#endif
+
+/* Open addressing table (SwissTable-like), the capacity is a power of two >= 16 */
+typedef struct hmap_s {
+  uint8_t *const u8_ctrl;   // Will hold the control bytes ref, one per slot
+  void *const    vSlots;    // Will hold the slots ref, each slot is {key, value}
+  uint16_t const u16_kSize; // Key size
+  uint16_t const u16_sSize; // Slot size
+  uint16_t const u16_vOffs; // Offset of the value within the slot
+  uint16_t const u16_vSize; // Value size, the slot can have trailing padding after it
+  uint32_t const u32_cap;   // Number of slots
+  uint32_t       u32_size;  // Number of keys stored
+  uint32_t       u32_tombs; // Number of deleted slots still breaking probe sequences
+} hmap_t;
+
+typedef hmap_t *hmap_handle_t;
+
+/* Separate chaining table, every bucket is a linked list holding {key, value} entries */
+typedef struct hmap_chain_s {
+  ll_handle_t *const pBuckets;  // Will hold the buckets ref
+  uint16_t const     u16_kSize; // Key size
+  uint32_t const     u32_vOffs; // Offset of the value within the entry
+  uint32_t const     u32_vSize; // Value size
+  uint32_t const     u32_nBkts; // Number of buckets, power of two
+  uint32_t           u32_size;  // Number of keys stored
+} hmap_chain_t;
+
+typedef hmap_chain_t *hmap_chain_handle_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HMAP_DATATYPES_H_ */
@@ -0,0 +1,78 @@
+/**
+ * @file hmap_defines.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Hash map definitions and macros
+ *
+ */
+
+#ifndef HMAP_DEFINES_H_
+#define HMAP_DEFINES_H_
+
+#include <stddef.h> /* offsetof */
+
+// clang-format off
+
+#define __HMAP_TYPE(ktype, vtype, map, size)                                     \
+  _Static_assert((16U <= (size)) && (0U == ((size) & ((size) - 1U))),            \
+                 #map " capacity shall be a power of two >= 16");                \
+  typedef struct { ktype key; vtype val; } map ## _slot_t;                       \
+  uint8_t       map ## _ctrl[size];                                              \
+  map ## _slot_t map ## _slots[size];                                            \
+  hmap_t map = {                                                                 \
+    .u8_ctrl   = map ## _ctrl,                                                   \
+    .vSlots    = map ## _slots,                                                  \
+    .u16_kSize = sizeof(ktype),                                                  \
+    .u16_sSize = sizeof(map ## _slot_t),                                         \
+    .u16_vOffs = offsetof(map ## _slot_t, val),                                  \
+    .u16_vSize = sizeof(vtype),                                                  \
+    .u32_cap   = size,                                                           \
+    .u32_size  = 0U,                                                             \
+    .u32_tombs = 0U,                                                             \
+  };
+
+#define _HMAP_DEF_TYPE(ktype, vtype, map, size)     \
+        __HMAP_TYPE(ktype, vtype, map, size)        \
+    base_t map ## _put_refd(ktype *k, vtype *pt)    \
+    {                                               \
+        return hmap_put(&map, k, pt);               \
+    }                                               \
+    base_t map ## _get_refd(ktype *k, vtype *pt)    \
+    {                                               \
+        return hmap_get(&map, k, pt);               \
+    }                                               \
+    base_t map ## _remove(ktype *k)                 \
+    {                                               \
+        return hmap_remove(&map, k);                \
+    }
+
+#define __HMAP_CHAIN_TYPE(ktype, vtype, map, buckets)                            \
+  _Static_assert((0U < (buckets)) && (0U == ((buckets) & ((buckets) - 1U))),     \
+                 #map " buckets shall be a power of two");                       \
+  typedef struct { ktype key; vtype val; } map ## _entry_t;                      \
+  ll_handle_t  map ## _buckets[buckets];                                         \
+  hmap_chain_t map = {                                                           \
+    .pBuckets  = map ## _buckets,                                                \
+    .u16_kSize = sizeof(ktype),                                                  \
+    .u32_vOffs = offsetof(map ## _entry_t, val),                                 \
+    .u32_vSize = sizeof(vtype),                                                  \
+    .u32_nBkts = buckets,                                                        \
+    .u32_size  = 0U,                                                             \
+  };
+
+#define _HMAP_CHAIN_DEF_TYPE(ktype, vtype, map, buckets)  \
+        __HMAP_CHAIN_TYPE(ktype, vtype, map, buckets)     \
+    base_t map ## _put_refd(ktype *k, vtype *pt)          \
+    {                                                     \
+        return hmap_chain_put(&map, k, pt);               \
+    }                                                     \
+    base_t map ## _get_refd(ktype *k, vtype *pt)          \
+    {                                                     \
+        return hmap_chain_get(&map, k, pt);               \
+    }                                                     \
+    base_t map ## _remove(ktype *k)                       \
+    {                                                     \
+        return hmap_chain_remove(&map, k);                \
+    }
+// clang-format on
+#endif /* HMAP_DEFINES_H_ */
@@ -31,12 +31,41 @@
  */
 
 #include "interpolate.h"
+#include "interpolation/interpolate_search.h"
+#include <math.h> // isnan
 
 float32_t interpolated_constant(float32_t const m, float32_t const x0, float32_t const y0) {
   float32_t const return_k = y0 - (m * x0);
   return return_k;
 }
 
+/* Estimates the value within the segment [domain[i], domain[i+1]) */
+static inline float32_t interpolated_segment(float32_t const input, float32_t const *domain,
+                                             float32_t const *range, int32_t i) {
+  if (input == domain[i]) return range[i]; // LUT hit, no need to interpolate
+
+  float const delta_y = range[i + 1] - range[i];
+  float const delta_x = domain[i + 1] - domain[i]; // Can't be 0
+  float const m       = delta_y / delta_x;
+  float const k       = interpolated_constant(m, domain[i], range[i]);
+
+  return ((m * input) + k);
+}
+
+/* Estimates the value within the segment i of a table */
+static inline float32_t interpolated_table_eval(float32_t const input, interp_table_t const *table,
+                                                int32_t i) {
+  float32_t f32_range_est = 0.0f;
+
+  if (input == table->domain[i]) { // LUT hit, no need to interpolate
+    f32_range_est = table->range[i];
+  } else {
+    f32_range_est = (table->segs[i].m * input) + table->segs[i].k;
+  }
+
+  return f32_range_est;
+}
+
 float32_t interpolated_estimate(float32_t const input, float32_t const *domain, float32_t const *range,
                                 int32_t length) {
   float32_t f32_range_est = 0.0f;
@@ -51,26 +80,106 @@ float32_t interpolated_estimate(float32_t const input, float32_t const *domain,
     else if (input >= domain[length - 1]) // Saturate case
       f32_range_est = range[length - 1];
 
-    else {
-      /* Range from 1 to len-1 (Only len-1 iter) The range[len-1] is validated on
-       * previous `else if` (saturate) case */
-      for (int32_t i = 1; i < length; ++i) {
-
-        if (input == domain[i - 1]) {
-          f32_range_est = range[i - 1];
-          break; // No need to check anymore
-        }
-
-        else if ((input > domain[i - 1]) && (input < domain[i])) {
-          float const delta_y = range[i] - range[i - 1];
-          float const delta_x = domain[i] - domain[i - 1]; // Can't be 0
-          float const m       = delta_y / delta_x;
-          float const k       = interpolated_constant(m, domain[i - 1], range[i - 1]);
-
-          f32_range_est = ((m * input) + k);
-          break;
-        }
-      }
+    else if ((1 < length) && !isnan(input)) { // A NaN is in no segment, 0 as no segment was found
+      /* The range[len-1] is validated on previous `else if` (saturate) case, so the search is
+       * performed on the first len-1 samples */
+      int32_t const i = interpolated_search(input, domain, length - 1);
+      f32_range_est   = interpolated_segment(input, domain, range, i);
+    }
+  }
+
+  return f32_range_est;
+}
+
+base_t interpolated_table_init(interp_table_t *table, interp_seg_t *segs, float32_t const *domain,
+                               float32_t const *range, int32_t length) {
+  base_t ret_val = NOT_OK;
+
+  bool_t valid = (NULL != table) && (NULL != domain) && (NULL != range) && (0 < length) &&
+                 ((NULL != segs) || (1 == length));
+
+  // Validates the domain: strictly increasing, so no delta_x is 0
+  for (int32_t i = 1; valid && (i < length); ++i) {
+    valid = (domain[i - 1] < domain[i]);
+  }
+
+  if (valid) {
+    // Same computation as the stateless estimation so both provide the same results
+    for (int32_t i = 0; i < length - 1; ++i) {
+      float const delta_y = range[i + 1] - range[i];
+      float const delta_x = domain[i + 1] - domain[i];
+
+      segs[i].m = delta_y / delta_x;
+      segs[i].k = interpolated_constant(segs[i].m, domain[i], range[i]);
+    }
+
+    table->domain   = domain;
+    table->range    = range;
+    table->segs     = segs;
+    table->length   = length;
+    table->inv_step = interpolated_inv_step(domain, length);
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
+
+int32_t interpolated_table_segment(float32_t const input, interp_table_t const *table) {
+  return interpolated_find(input, table->domain, table->length, table->inv_step);
+}
+
+float32_t interpolated_table_estimate(float32_t const input, interp_table_t const *table) {
+  float32_t f32_range_est = 0.0f;
+
+  if ((NULL != table) && (NULL != table->domain) && (0 < table->length)) {
+    int32_t const length = table->length;
+
+    if (input <= table->domain[0U]) // Saturate case
+      f32_range_est = table->range[0U];
+
+    else if (input >= table->domain[length - 1]) // Saturate case
+      f32_range_est = table->range[length - 1];
+
+    else if ((1 < length) && !isnan(input)) { // A NaN is in no segment, 0 as `interpolated_estimate`
+      int32_t const i = interpolated_table_segment(input, table);
+      f32_range_est   = interpolated_table_eval(input, table, i);
+    }
+  }
+
+  return f32_range_est;
+}
+
+base_t interpolated_cursor_init(interp_cursor_t *cursor, interp_table_t const *table) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != cursor) && (NULL != table) && (NULL != table->domain) && (0 < table->length)) {
+    cursor->table = table;
+    cursor->seg   = 0;
+    ret_val       = OK;
+  }
+
+  return ret_val;
+}
+
+float32_t interpolated_cursor_estimate(float32_t const input, interp_cursor_t *cursor) {
+  float32_t f32_range_est = 0.0f;
+
+  if ((NULL != cursor) && (NULL != cursor->table)) {
+    interp_table_t const *table  = cursor->table;
+    int32_t const         length = table->length;
+
+    if (input <= table->domain[0U]) // Saturate case, the cursor is kept
+      f32_range_est = table->range[0U];
+
+    else if (input >= table->domain[length - 1]) // Saturate case
+      f32_range_est = table->range[length - 1];
+
+    else if ((1 < length) && !isnan(input)) { // A NaN is in no segment, 0 and the cursor is kept
+      int32_t const last = length - 2; // Clamped in case the table was rebuilt shorter
+      int32_t const from = (cursor->seg < last) ? cursor->seg : last;
+      int32_t const i    = interpolated_gallop(input, table->domain, from, last);
+      cursor->seg     = i;
+      f32_range_est   = interpolated_table_eval(input, table, i);
     }
   }
 
@@ -0,0 +1,132 @@
+/**
+ * @file interpolate.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define a compile-time Linear Interpolation table (constexpr)
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef INTERPOLATE_HPP_
+#define INTERPOLATE_HPP_
+
+#include <cstddef>
+
+namespace c_utils {
+
+namespace detail {
+// Not constexpr: reaching it on a constant evaluation stops the compilation with this name on the error
+inline void interp_domain_not_strictly_increasing() {}
+} // namespace detail
+
+// Linear Interpolation table of N samples built at compile time. Same results as the C
+// `interpolated_estimate` (LUT hit, interpolation and saturation). The run-time estimation is evaluated on
+// the user TU: it's bit exact with the C library (built with -ffp-contract=off) only if the TU is built
+// without contraction as well, otherwise an FMA target (aarch64, -mfma) can differ on the last ulp.
+//   constexpr c_utils::Interp steering({ -22.f, -11.f, 0.f, 10.f, 20.f }, { -1.5f, -1.f, 0.f, 1.2f, 1.8f });
+//   constexpr float v = steering(15.f); // Folded to 1.5f
+template <std::size_t N> class Interp {
+  static_assert(N > 1, "An interpolation table needs at least 2 samples");
+
+private:
+  struct Seg {
+    float m = 0.0f; // Slope
+    float k = 0.0f; // Intercept
+  };
+
+  float _domain[N]   = {};
+  float _range[N]    = {};
+  Seg   _segs[N - 1] = {};
+  bool  _valid       = false;
+
+  // Fixed-size branch-light binary search, unrolled by the compiler (log2(N) steps).
+  // Requires _domain[0] < x < _domain[N-1], returns i such as _domain[i] <= x < _domain[i+1]
+  constexpr std::size_t segment(float x) const {
+    std::size_t base = 0;
+    std::size_t len  = N - 1;
+    while (len > 1) {
+      std::size_t const half = len >> 1;
+      base                   = (_domain[base + half] <= x) ? (base + half) : base;
+      len -= half;
+    }
+    return base;
+  }
+
+public:
+  // Builds the slopes and intercepts. A domain not strictly increasing is a compile error when the table is
+  // constexpr, otherwise the table is not valid and estimates 0 (as the C tables)
+  constexpr Interp(float const (&domain)[N], float const (&range)[N]) {
+    bool increasing = true;
+    for (std::size_t i = 0; i < N; ++i) {
+      _domain[i] = domain[i];
+      _range[i]  = range[i];
+      if ((0 < i) && !(domain[i - 1] < domain[i])) increasing = false;
+    }
+    if (!increasing) {
+      detail::interp_domain_not_strictly_increasing();
+    } else {
+      // Same computation as the C estimation so both provide the same results
+      for (std::size_t i = 0; i < N - 1; ++i) {
+        float const delta_y = range[i + 1] - range[i];
+        float const delta_x = domain[i + 1] - domain[i];
+        _segs[i].m          = delta_y / delta_x;
+        _segs[i].k          = range[i] - (_segs[i].m * domain[i]);
+      }
+      _valid = true;
+    }
+  }
+
+  constexpr bool valid() const {
+    return _valid;
+  }
+
+  constexpr std::size_t size() const {
+    return N;
+  }
+
+  constexpr float estimate(float x) const {
+    float y = 0.0f;
+    if (!_valid || (x != x)) { // A NaN is in no segment, 0 as the C estimation (isnan is not constexpr)
+      y = 0.0f;
+    } else if (x <= _domain[0]) { // Saturate case
+      y = _range[0];
+    } else if (x >= _domain[N - 1]) { // Saturate case
+      y = _range[N - 1];
+    } else {
+      std::size_t const i = segment(x);
+      y                   = (x == _domain[i]) ? _range[i] : ((_segs[i].m * x) + _segs[i].k);
+    }
+    return y;
+  }
+
+  constexpr float operator()(float x) const {
+    return estimate(x);
+  }
+};
+
+} // namespace c_utils
+
+#endif /* INTERPOLATE_HPP_ */
@@ -0,0 +1,332 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file interpolate_batch.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the batch estimation of arrays of inputs against a table object, and of one input
+ * against a bank of tables
+ *
+ * The segment search, the gathers of the segment data and the evaluation are performed on all the lanes of
+ * a vector at once. The AVX2 kernel (8 lanes, hardware gathers) is selected at runtime, the SSE2 kernel
+ * (4 lanes) covers the rest of the block and the scalar estimation the tail. The kernels replicate the
+ * scalar operations (mul then add, same clamping and saturation), so the results are bit-exact.
+ *
+ * A bank is searched once, then its tables are evaluated on the lanes with contiguous loads of the
+ * structure-of-arrays slopes and intercepts (no gathers needed).
+ */
+
+#include "interpolate.h"
+#include "interpolation/interpolate_search.h"
+#include <math.h> // isnan
+
+#if defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+  #define INTERP_SIMD_X86 1
+  #include <immintrin.h>
+#endif
+
+#ifdef INTERP_SIMD_X86
+
+/* Emulated gather (SSE2 has no gather instruction) */
+static inline __m128 interp_gather_sse2(float32_t const *base, __m128i idx) {
+  int32_t i[4];
+  _mm_storeu_si128((__m128i *)i, idx);
+  return _mm_set_ps(base[i[3]], base[i[2]], base[i[1]], base[i[0]]);
+}
+
+static inline __m128 interp_select_sse2(__m128 mask, __m128 a, __m128 b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/* Same segment search as interpolated_table_segment on 4 lanes */
+static inline __m128i interp_segment_sse2(__m128 x, interp_table_t const *table) {
+  float32_t const *domain = table->domain;
+  int32_t const    last   = table->length - 2;
+  __m128i          i      = _mm_setzero_si128();
+
+  if (0.0f != table->inv_step) {
+    __m128 pos = _mm_mul_ps(_mm_sub_ps(x, _mm_set1_ps(domain[0])), _mm_set1_ps(table->inv_step));
+    // max returns the 2nd operand on NaN, so a NaN position goes to 0 (in bounds, its result is masked)
+    pos = _mm_min_ps(_mm_max_ps(pos, _mm_setzero_ps()), _mm_set1_ps((float32_t)last));
+    i   = _mm_cvttps_epi32(pos);
+
+    // Index correction, both conditions can't be true at once on a strictly increasing domain
+    __m128i const dec = _mm_and_si128(_mm_cmpgt_epi32(i, _mm_setzero_si128()),
+                                      _mm_castps_si128(_mm_cmplt_ps(x, interp_gather_sse2(domain, i))));
+    __m128i const inc =
+        _mm_and_si128(_mm_cmplt_epi32(i, _mm_set1_epi32(last)),
+                      _mm_castps_si128(_mm_cmpge_ps(x, interp_gather_sse2(domain + 1, i))));
+    i = _mm_sub_epi32(_mm_add_epi32(i, dec), inc); // masks are -1
+  } else {
+    // Binary search in lockstep, every lane performs the same number of steps
+    int32_t length = last + 1;
+    while (length > 1) {
+      int32_t const half  = length >> 1;
+      __m128i const probe = _mm_add_epi32(i, _mm_set1_epi32(half));
+      __m128 const  le    = _mm_cmple_ps(interp_gather_sse2(domain, probe), x);
+      i                   = _mm_add_epi32(i, _mm_and_si128(_mm_castps_si128(le), _mm_set1_epi32(half)));
+      length -= half;
+    }
+  }
+
+  return i;
+}
+
+static inline __m128 interp_estimate_sse2(__m128 x, interp_table_t const *table) {
+  float32_t const *domain = table->domain;
+  float32_t const *range  = table->range;
+  float32_t const *segs   = (float32_t const *)table->segs; // {m, k} interleaved
+  int32_t const    length = table->length;
+
+  __m128i const i  = interp_segment_sse2(x, table);
+  __m128i const i2 = _mm_add_epi32(i, i);
+
+  __m128 y = _mm_add_ps(_mm_mul_ps(interp_gather_sse2(segs, i2), x), interp_gather_sse2(segs + 1, i2));
+  y = interp_select_sse2(_mm_cmpeq_ps(x, interp_gather_sse2(domain, i)), interp_gather_sse2(range, i), y);
+  y = interp_select_sse2(_mm_cmpge_ps(x, _mm_set1_ps(domain[length - 1])), _mm_set1_ps(range[length - 1]), y);
+  y = interp_select_sse2(_mm_cmple_ps(x, _mm_set1_ps(domain[0])), _mm_set1_ps(range[0]), y);
+  y = _mm_and_ps(_mm_cmpord_ps(x, x), y); // A NaN is in no segment, 0 as the scalar estimation
+
+  return y;
+}
+
+static int32_t interp_batch_sse2(float32_t const *inputs, float32_t *outputs, int32_t n,
+                                 interp_table_t const *table) {
+  int32_t i = 0;
+  for (; (i + 4) <= n; i += 4) {
+    _mm_storeu_ps(outputs + i, interp_estimate_sse2(_mm_loadu_ps(inputs + i), table));
+  }
+  return i;
+}
+
+/* Same search as interp_segment_sse2 on 8 lanes with hardware gathers. Built without FMA on purpose: a
+ * fused mul-add rounds once and would not match the scalar estimation */
+__attribute__((target("avx2"))) static inline __m256i interp_segment_avx2(__m256               x,
+                                                                          interp_table_t const *table) {
+  float32_t const *domain = table->domain;
+  int32_t const    last   = table->length - 2;
+  __m256i          i      = _mm256_setzero_si256();
+
+  if (0.0f != table->inv_step) {
+    __m256 pos = _mm256_mul_ps(_mm256_sub_ps(x, _mm256_set1_ps(domain[0])), _mm256_set1_ps(table->inv_step));
+    pos        = _mm256_min_ps(_mm256_max_ps(pos, _mm256_setzero_ps()), _mm256_set1_ps((float32_t)last));
+    i          = _mm256_cvttps_epi32(pos);
+
+    __m256 const  lo  = _mm256_cmp_ps(x, _mm256_i32gather_ps(domain, i, 4), _CMP_LT_OQ);
+    __m256 const  hi  = _mm256_cmp_ps(x, _mm256_i32gather_ps(domain + 1, i, 4), _CMP_GE_OQ);
+    __m256i const dec =
+        _mm256_and_si256(_mm256_cmpgt_epi32(i, _mm256_setzero_si256()), _mm256_castps_si256(lo));
+    __m256i const inc =
+        _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(last), i), _mm256_castps_si256(hi));
+    i                 = _mm256_sub_epi32(_mm256_add_epi32(i, dec), inc);
+  } else {
+    int32_t length = last + 1;
+    while (length > 1) {
+      int32_t const half  = length >> 1;
+      __m256i const probe = _mm256_add_epi32(i, _mm256_set1_epi32(half));
+      __m256 const  le    = _mm256_cmp_ps(_mm256_i32gather_ps(domain, probe, 4), x, _CMP_LE_OQ);
+      i = _mm256_add_epi32(i, _mm256_and_si256(_mm256_castps_si256(le), _mm256_set1_epi32(half)));
+      length -= half;
+    }
+  }
+
+  return i;
+}
+
+__attribute__((target("avx2"))) static inline __m256 interp_estimate_avx2(__m256               x,
+                                                                          interp_table_t const *table) {
+  float32_t const *domain = table->domain;
+  float32_t const *range  = table->range;
+  float32_t const *segs   = (float32_t const *)table->segs;
+  int32_t const    length = table->length;
+
+  __m256i const i  = interp_segment_avx2(x, table);
+  __m256i const i2 = _mm256_add_epi32(i, i);
+
+  __m256 y = _mm256_add_ps(_mm256_mul_ps(_mm256_i32gather_ps(segs, i2, 4), x),
+                           _mm256_i32gather_ps(segs + 1, i2, 4));
+  y        = _mm256_blendv_ps(y, _mm256_i32gather_ps(range, i, 4),
+                              _mm256_cmp_ps(x, _mm256_i32gather_ps(domain, i, 4), _CMP_EQ_OQ));
+  y        = _mm256_blendv_ps(y, _mm256_set1_ps(range[length - 1]),
+                              _mm256_cmp_ps(x, _mm256_set1_ps(domain[length - 1]), _CMP_GE_OQ));
+  y        = _mm256_blendv_ps(y, _mm256_set1_ps(range[0]),
+                              _mm256_cmp_ps(x, _mm256_set1_ps(domain[0]), _CMP_LE_OQ));
+  y        = _mm256_and_ps(_mm256_cmp_ps(x, x, _CMP_ORD_Q), y); // A NaN is in no segment, 0 as scalar
+
+  return y;
+}
+
+__attribute__((target("avx2"))) static int32_t interp_batch_avx2(float32_t const *inputs, float32_t *outputs,
+                                                                 int32_t n, interp_table_t const *table) {
+  int32_t i = 0;
+  for (; (i + 8) <= n; i += 8) {
+    _mm256_storeu_ps(outputs + i, interp_estimate_avx2(_mm256_loadu_ps(inputs + i), table));
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) static int32_t interp_bank_avx2(float32_t const *m, float32_t const *k,
+                                                                float32_t const x, float32_t *outputs,
+                                                                int32_t count) {
+  __m256 const vx = _mm256_set1_ps(x);
+  int32_t      i  = 0;
+  for (; (i + 8) <= count; i += 8) {
+    __m256 const y = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(m + i), vx), _mm256_loadu_ps(k + i));
+    _mm256_storeu_ps(outputs + i, y);
+  }
+  return i;
+}
+
+static int32_t interp_bank_sse2(float32_t const *m, float32_t const *k, float32_t const x, float32_t *outputs,
+                                int32_t count) {
+  __m128 const vx = _mm_set1_ps(x);
+  int32_t      i  = 0;
+  for (; (i + 4) <= count; i += 4) {
+    _mm_storeu_ps(outputs + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(m + i), vx), _mm_loadu_ps(k + i)));
+  }
+  return i;
+}
+
+#endif /* INTERP_SIMD_X86 */
+
+base_t interpolated_estimate_n(float32_t const *inputs, float32_t *outputs, int32_t n,
+                               interp_table_t const *table) {
+  base_t  ret_val = NOT_OK;
+  int32_t done    = 0;
+
+  if ((NULL != inputs) && (NULL != outputs) && (0 <= n) && (NULL != table) && (NULL != table->domain) &&
+      (0 < table->length)) {
+#ifdef INTERP_SIMD_X86
+    // Tables with a single sample have no segments, those are left to the scalar estimation
+    if ((1 < table->length) && (NULL != table->segs)) {
+      if (__builtin_cpu_supports("avx2")) {
+        done = interp_batch_avx2(inputs, outputs, n, table);
+      }
+      done += interp_batch_sse2(inputs + done, outputs + done, n - done, table);
+    }
+#endif
+    for (; done < n; ++done) {
+      outputs[done] = interpolated_table_estimate(inputs[done], table);
+    }
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
+
+
+base_t interpolated_bank_init(interp_bank_t *bank, float32_t *values, float32_t *slopes, float32_t *icepts,
+                              float32_t const *domain, float32_t const *const *ranges, int32_t length,
+                              int32_t count) {
+  base_t ret_val = NOT_OK;
+
+  bool_t valid = (NULL != bank) && (NULL != values) && (NULL != slopes) && (NULL != icepts) &&
+                 (NULL != domain) && (NULL != ranges) && (1 < length) && (0 < count);
+
+  // Validates the domain: strictly increasing, so no delta_x is 0
+  for (int32_t i = 1; valid && (i < length); ++i) {
+    valid = (domain[i - 1] < domain[i]);
+  }
+  for (int32_t t = 0; valid && (t < count); ++t) {
+    valid = (NULL != ranges[t]);
+  }
+
+  if (valid) {
+    for (int32_t i = 0; i < length; ++i) {
+      for (int32_t t = 0; t < count; ++t) {
+        values[(i * count) + t] = ranges[t][i];
+      }
+    }
+    // Same computation as the table objects so both provide the same results
+    for (int32_t i = 0; i < length - 1; ++i) {
+      float const delta_x = domain[i + 1] - domain[i];
+
+      for (int32_t t = 0; t < count; ++t) {
+        float const delta_y = ranges[t][i + 1] - ranges[t][i];
+        float const m       = delta_y / delta_x;
+
+        slopes[(i * count) + t] = m;
+        icepts[(i * count) + t] = interpolated_constant(m, domain[i], ranges[t][i]);
+      }
+    }
+
+    bank->domain   = domain;
+    bank->values   = values;
+    bank->slopes   = slopes;
+    bank->icepts   = icepts;
+    bank->length   = length;
+    bank->count    = count;
+    bank->inv_step = interpolated_inv_step(domain, length);
+    ret_val        = OK;
+  }
+
+  return ret_val;
+}
+
+base_t interpolated_bank_estimate(float32_t const input, interp_bank_t const *bank, float32_t *outputs) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != bank) && (NULL != bank->domain) && (NULL != outputs)) {
+    int32_t const    length = bank->length;
+    int32_t const    count  = bank->count;
+    float32_t const *row    = NULL; // Samples of all the tables at a breakpoint (saturation or LUT hit)
+    int32_t          seg    = 0;
+
+    if (input <= bank->domain[0U]) { // Saturate case
+      row = bank->values;
+    } else if (input >= bank->domain[length - 1]) { // Saturate case
+      row = bank->values + ((length - 1) * count);
+    } else if (!isnan(input)) {
+      seg = interpolated_find(input, bank->domain, length, bank->inv_step); // Single search for all
+      row = (input == bank->domain[seg]) ? (bank->values + (seg * count)) : NULL;
+    }
+
+    if (isnan(input)) { // A NaN is in no segment, 0 as `interpolated_table_estimate`
+      for (int32_t t = 0; t < count; ++t) {
+        outputs[t] = 0.0f;
+      }
+    } else if (NULL != row) {
+      for (int32_t t = 0; t < count; ++t) {
+        outputs[t] = row[t];
+      }
+    } else {
+      float32_t const *m    = bank->slopes + (seg * count);
+      float32_t const *k    = bank->icepts + (seg * count);
+      int32_t          done = 0;
+#ifdef INTERP_SIMD_X86
+      if (__builtin_cpu_supports("avx2")) {
+        done = interp_bank_avx2(m, k, input, outputs, count);
+      }
+      done += interp_bank_sse2(m + done, k + done, input, outputs + done, count - done);
+#endif
+      for (; done < count; ++done) {
+        outputs[done] = (m[done] * input) + k[done];
+      }
+    }
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * @file interpolate_datatypes.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Linear Interpolation datatypes definition
+ *
+ */
+
+#ifndef INTERPOLATE_DATATYPES_H_
+#define INTERPOLATE_DATATYPES_H_
+
+// Includes
+#include "utils_common.h"
+#include "interpolation/interpolate_defines.h"
+
+/* Precomputed line of a segment, y = (m * x) + k. Interleaved so an evaluation touches a single line */
+typedef struct interp_seg_s {
+  float32_t m; // Slope
+  float32_t k; // Intercept
+} interp_seg_t;
+
+typedef struct interp_table_s {
+  float32_t const *domain;   // Sampled input data (x-axis), strictly increasing
+  float32_t const *range;    // Sampled output data (y-axis)
+  interp_seg_t    *segs;     // Will hold the segments ref, length - 1 segments
+  int32_t          length;   // Number of samples
+  float32_t        inv_step; // 1 / step of a uniformly spaced domain, 0 if irregular
+} interp_table_t;
+
+/* Precomputed slope of a fixed-point segment, m / 2^shift. Normalized so m keeps up to 31 significant bits */
+typedef struct interp_qseg_s {
+  int32_t m;     // Slope mantissa
+  int32_t shift; // Fractional bits of the slope
+} interp_qseg_t;
+
+typedef struct interp_q15_table_s {
+  int16_t const *domain; // Sampled input data (x-axis), strictly increasing
+  int16_t const *range;  // Sampled output data (y-axis)
+  interp_qseg_t *segs;   // Will hold the segments ref, length - 1 segments
+  int32_t        length; // Number of samples
+} interp_q15_table_t;
+
+typedef struct interp_q31_table_s {
+  int32_t const *domain; // Sampled input data (x-axis), strictly increasing
+  int32_t const *range;  // Sampled output data (y-axis)
+  interp_qseg_t *segs;   // Will hold the segments ref, length - 1 segments
+  int32_t        length; // Number of samples
+} interp_q31_table_t;
+
+/* Keeps the last segment found on a table, consecutive lookups start from it */
+typedef struct interp_cursor_s {
+  interp_table_t const *table; // Table object being walked
+  int32_t               seg;   // Last segment found
+} interp_cursor_t;
+
+/* Bank of tables sharing a domain, in structure-of-arrays form: the data of the `count` tables at a
+ * breakpoint (or segment) i is contiguous from i * count */
+typedef struct interp_bank_s {
+  float32_t const *domain;   // Sampled input data (x-axis) shared by all the tables, strictly increasing
+  float32_t       *values;   // Sampled output data, length * count
+  float32_t       *slopes;   // Slopes of the segments, (length - 1) * count
+  float32_t       *icepts;   // Intercepts of the segments, (length - 1) * count
+  int32_t          length;   // Number of samples
+  int32_t          count;    // Number of tables
+  float32_t        inv_step; // 1 / step of a uniformly spaced domain, 0 if irregular
+} interp_bank_t;
+
+/* Result of a uniform resampling */
+typedef struct interp_resample_report_s {
+  int32_t   length;  // Samples of the uniform grid
+  float32_t max_err; // Max error to the original table, at its breakpoints
+  uint32_t  bytes;   // Memory of the resampled table: domain, range and segments
+} interp_resample_report_t;
+
+/* Cubic of a segment on the local coordinate t = x - domain[i], y = a + t * (b + t * (c + t * d)) */
+typedef struct interp_cubic_s {
+  float32_t a;
+  float32_t b;
+  float32_t c;
+  float32_t d;
+} interp_cubic_t;
+
+typedef enum interp_spline_kind_e {
+  INTERP_SPLINE_NATURAL = 0, // C2 cubic spline with zero curvature at both ends
+  INTERP_SPLINE_PCHIP,       // Monotone piecewise cubic Hermite (C1, no overshoot between samples)
+} interp_spline_kind_t;
+
+typedef struct interp_spline_s {
+  float32_t const *domain;   // Sampled input data (x-axis), strictly increasing
+  float32_t const *range;    // Sampled output data (y-axis)
+  interp_cubic_t  *cubics;   // Will hold the segments ref, length - 1 segments
+  int32_t          length;   // Number of samples
+  float32_t        inv_step; // 1 / step of a uniformly spaced domain, 0 if irregular
+} interp_spline_t;
+
+/* Multi-dimensional map, the values are contiguous in row-major order (the last axis is the fastest) */
+typedef struct interp_map_s {
+  float32_t const *axes[INTERP_MAP_MAX_DIMS];    // Breakpoints of each axis, strictly increasing
+  int32_t          lengths[INTERP_MAP_MAX_DIMS]; // Number of breakpoints of each axis
+  int32_t          strides[INTERP_MAP_MAX_DIMS]; // Distance between consecutive breakpoints of each axis
+  float32_t const *values;                       // lengths[0] * ... * lengths[dims-1] values
+  int32_t          dims;                         // Number of axes
+} interp_map_t;
+
+/* Keeps the last segment found on each axis of a map */
+typedef struct interp_map_cursor_s {
+  interp_map_t const *map;                      // Map object being walked
+  int32_t             seg[INTERP_MAP_MAX_DIMS]; // Last segment found on each axis
+} interp_map_cursor_t;
+
+#endif /* INTERPOLATE_DATATYPES_H_ */
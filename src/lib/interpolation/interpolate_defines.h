@@ -0,0 +1,70 @@
+/**
+ * @file interpolate_defines.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Linear Interpolation definitions and macros
+ *
+ */
+
+#ifndef INTERPOLATE_DEFINES_H_
+#define INTERPOLATE_DEFINES_H_
+
+#define INTERP_Q15_MIN    (-32768)
+#define INTERP_Q15_MAX    (32767)
+#define INTERP_Q31_MIN    (-2147483647 - 1)
+#define INTERP_Q31_MAX    (2147483647)
+#define INTERP_QSHIFT_MAX (30) // Max fractional bits of a slope, m * dx can't overflow an int64_t
+#define INTERP_MAP_MAX_DIMS (4) // Max dimensions of a map, 2^dims corners are blended
+
+// clang-format off
+
+#define _INTERP_DEF_TABLE(table, size)              \
+  interp_seg_t   table ## _segs[(size) - 1];        \
+  interp_table_t table = {                          \
+    .domain   = NULL,                               \
+    .range    = NULL,                               \
+    .segs     = table ## _segs,                     \
+    .length   = 0,                                  \
+    .inv_step = 0.0f,                               \
+  }
+
+#define _INTERP_DEF_QTABLE(qtype, table, size)      \
+  interp_qseg_t                table ## _segs[(size) - 1]; \
+  interp_ ## qtype ## _table_t table = {            \
+    .domain = NULL,                                 \
+    .range  = NULL,                                 \
+    .segs   = table ## _segs,                       \
+    .length = 0,                                    \
+  }
+
+#define _INTERP_DEF_RESAMPLED(table, size)          \
+  float32_t      table ## _domain[(size)];          \
+  float32_t      table ## _range[(size)];           \
+  _INTERP_DEF_TABLE(table, size)
+
+#define _INTERP_DEF_BANK(bank, size, tables)           \
+  float32_t     bank ## _values[(size)][(tables)];     \
+  float32_t     bank ## _slopes[(size) - 1][(tables)]; \
+  float32_t     bank ## _icepts[(size) - 1][(tables)]; \
+  interp_bank_t bank = {                               \
+    .domain   = NULL,                                  \
+    .values   = &bank ## _values[0][0],                \
+    .slopes   = &bank ## _slopes[0][0],                \
+    .icepts   = &bank ## _icepts[0][0],                \
+    .length   = 0,                                     \
+    .count    = 0,                                     \
+    .inv_step = 0.0f,                                  \
+  }
+
+#define _INTERP_DEF_SPLINE(spline, size)            \
+  interp_cubic_t  spline ## _cubics[(size) - 1];    \
+  interp_spline_t spline = {                        \
+    .domain   = NULL,                               \
+    .range    = NULL,                               \
+    .cubics   = spline ## _cubics,                  \
+    .length   = 0,                                  \
+    .inv_step = 0.0f,                               \
+  }
+
+// clang-format on
+#endif /* INTERPOLATE_DEFINES_H_ */
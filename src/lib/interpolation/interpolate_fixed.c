@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file interpolate_fixed.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the fixed-point (Q15 and Q31) Linear Interpolation
+ *
+ * Integer samples (e.g. ADC readings) are interpolated without the FPU. The slope of every segment is
+ * precomputed as m / 2^shift with the largest shift that keeps m in 31 bits, so a segment keeps its
+ * precision whatever its steepness. An estimation is y0 + ((m * (x - x0)) >> shift) rounded to the nearest
+ * and saturated to the Q format, the error to the exact value is <= 1 LSB for Q15 and <= 3 LSB for Q31.
+ */
+
+#include "interpolate.h"
+
+/* Division rounded to the nearest (half away from zero), den > 0 */
+static inline int64_t interp_div_round(int64_t num, int64_t den) {
+  return (0 <= num) ? ((num + (den / 2)) / den) : -((-num + (den / 2)) / den);
+}
+
+/* Normalized slope dy / dx, dx > 0. A slope over 31 bits (Q31 only) means dx is 1, the segment is then a
+ * single point (LUT hit) and the slope is never used */
+static void interp_qseg_init(interp_qseg_t *seg, int64_t dy, int64_t dx) {
+  int32_t shift = INTERP_QSHIFT_MAX;
+  int64_t m     = interp_div_round(dy * ((int64_t)1 << shift), dx);
+
+  while ((0 < shift) && ((INTERP_Q31_MAX < m) || (INTERP_Q31_MIN > m))) {
+    --shift;
+    m = interp_div_round(dy * ((int64_t)1 << shift), dx);
+  }
+  if (INTERP_Q31_MAX < m) m = INTERP_Q31_MAX;
+  if (INTERP_Q31_MIN > m) m = INTERP_Q31_MIN;
+
+  seg->m     = (int32_t)m;
+  seg->shift = shift;
+}
+
+/* Defines the table functions of a Q format (qtype) with samples of type stype */
+#define INTERP_QTABLE_DEFINE(qtype, stype, qmin, qmax)                                                    \
+                                                                                                          \
+  /* Branch-light binary search, requires domain[0] <= input < domain[length] */                         \
+  static inline int32_t interp_##qtype##_search(stype const input, stype const *domain, int32_t length) { \
+    stype const *base = domain;                                                                           \
+    while (length > 1) {                                                                                  \
+      int32_t const half = length >> 1;                                                                   \
+      base               = (base[half] <= input) ? (base + half) : base;                                  \
+      length -= half;                                                                                     \
+    }                                                                                                     \
+    return (int32_t)(base - domain);                                                                      \
+  }                                                                                                       \
+                                                                                                          \
+  /* Gallops from the segment i, requires domain[0] < input < domain[last+1] */                          \
+  static inline int32_t interp_##qtype##_gallop(stype const input, stype const *domain, int32_t i,        \
+                                                int32_t last) {                                           \
+    int32_t lo   = i;                                                                                     \
+    int32_t hi   = i + 1;                                                                                 \
+    int32_t step = 1;                                                                                     \
+    if (input >= domain[hi]) {                                                                            \
+      lo = hi;                                                                                            \
+      while (((lo + step) <= last) && (domain[lo + step] <= input)) {                                     \
+        lo += step;                                                                                       \
+        step <<= 1;                                                                                       \
+      }                                                                                                   \
+      hi = ((lo + step) <= last) ? (lo + step) : (last + 1);                                              \
+      i  = lo + interp_##qtype##_search(input, domain + lo, hi - lo);                                     \
+    } else if (input < domain[lo]) {                                                                      \
+      hi = lo;                                                                                            \
+      while (((hi - step) >= 0) && (domain[hi - step] > input)) {                                         \
+        hi -= step;                                                                                       \
+        step <<= 1;                                                                                       \
+      }                                                                                                   \
+      lo = ((hi - step) >= 0) ? (hi - step) : 0;                                                          \
+      i  = lo + interp_##qtype##_search(input, domain + lo, hi - lo);                                     \
+    }                                                                                                     \
+    return i;                                                                                             \
+  }                                                                                                       \
+                                                                                                          \
+  /* Saturating estimation within the segment i */                                                        \
+  static inline stype interp_##qtype##_eval(stype const input, interp_##qtype##_table_t const *table,     \
+                                            int32_t i) {                                                  \
+    interp_qseg_t const seg  = table->segs[i];                                                            \
+    int64_t const       prod = (int64_t)seg.m * ((int64_t)input - (int64_t)table->domain[i]);             \
+    int64_t const       rnd  = (0 < seg.shift) ? ((int64_t)1 << (seg.shift - 1)) : 0;                     \
+    int64_t             y    = (int64_t)table->range[i] + ((prod + rnd) >> seg.shift);                    \
+    y                        = (qmax < y) ? qmax : ((qmin > y) ? qmin : y);                               \
+    return (stype)y;                                                                                      \
+  }                                                                                                       \
+                                                                                                          \
+  /* Saturates out of the domain, otherwise finds the segment from *seg and estimates the value */        \
+  static inline stype interp_##qtype##_lookup(stype const input, interp_##qtype##_table_t const *table,   \
+                                              int32_t *seg) {                                             \
+    int32_t const length = table->length;                                                                 \
+    stype         y      = table->range[0];                                                               \
+    if (input >= table->domain[length - 1]) {                                                             \
+      y = table->range[length - 1];                                                                       \
+    } else if (input > table->domain[0]) {                                                                \
+      *seg = interp_##qtype##_gallop(input, table->domain, *seg, length - 2);                             \
+      y    = interp_##qtype##_eval(input, table, *seg);                                                   \
+    }                                                                                                     \
+    return y;                                                                                             \
+  }                                                                                                       \
+                                                                                                          \
+  base_t interpolated_##qtype##_table_init(interp_##qtype##_table_t *table, interp_qseg_t *segs,          \
+                                           stype const *domain, stype const *range, int32_t length) {     \
+    base_t ret_val = NOT_OK;                                                                              \
+    bool_t valid   = (NULL != table) && (NULL != domain) && (NULL != range) && (0 < length) &&            \
+                   ((NULL != segs) || (1 == length));                                                     \
+    for (int32_t i = 1; valid && (i < length); ++i) {                                                     \
+      valid = (domain[i - 1] < domain[i]);                                                                \
+    }                                                                                                     \
+    if (valid) {                                                                                          \
+      for (int32_t i = 0; i < length - 1; ++i) {                                                          \
+        interp_qseg_init(&segs[i], (int64_t)range[i + 1] - (int64_t)range[i],                             \
+                         (int64_t)domain[i + 1] - (int64_t)domain[i]);                                    \
+      }                                                                                                   \
+      table->domain = domain;                                                                             \
+      table->range  = range;                                                                              \
+      table->segs   = segs;                                                                               \
+      table->length = length;                                                                             \
+      ret_val       = OK;                                                                                 \
+    }                                                                                                     \
+    return ret_val;                                                                                       \
+  }                                                                                                       \
+                                                                                                          \
+  stype interpolated_##qtype##_estimate(stype const input, interp_##qtype##_table_t const *table) {       \
+    stype   y   = 0;                                                                                      \
+    int32_t seg = 0; /* Galloping from the first segment is O(log length) as the binary search */         \
+    if ((NULL != table) && (NULL != table->domain) && (0 < table->length)) {                              \
+      y = interp_##qtype##_lookup(input, table, &seg);                                                    \
+    }                                                                                                     \
+    return y;                                                                                             \
+  }                                                                                                       \
+                                                                                                          \
+  base_t interpolated_##qtype##_estimate_n(stype const *inputs, stype *outputs, int32_t n,                \
+                                           interp_##qtype##_table_t const *table) {                       \
+    base_t  ret_val = NOT_OK;                                                                             \
+    int32_t seg     = 0; /* Consecutive samples are close, each lookup gallops from the previous one */   \
+    if ((NULL != inputs) && (NULL != outputs) && (0 <= n) && (NULL != table) && (NULL != table->domain) && \
+        (0 < table->length)) {                                                                            \
+      for (int32_t i = 0; i < n; ++i) {                                                                   \
+        outputs[i] = interp_##qtype##_lookup(inputs[i], table, &seg);                                     \
+      }                                                                                                   \
+      ret_val = OK;                                                                                       \
+    }                                                                                                     \
+    return ret_val;                                                                                       \
+  }
+
+INTERP_QTABLE_DEFINE(q15, int16_t, INTERP_Q15_MIN, INTERP_Q15_MAX)
+INTERP_QTABLE_DEFINE(q31, int32_t, INTERP_Q31_MIN, INTERP_Q31_MAX)
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file interpolate_map.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the multi-dimensional (bilinear, trilinear and multilinear) Linear Interpolation
+ *
+ * The segment of each axis is found by galloping from the last one found on that axis (the search cache),
+ * then the 2^dims corners of the cell are blended by successive linear interpolations, from the last axis
+ * to the first. The values are contiguous in row-major order, so the corners of the last axis are adjacent.
+ */
+
+#include "interpolate.h"
+#include "interpolation/interpolate_search.h"
+
+static inline float32_t interp_lerp(float32_t const a, float32_t const b, float32_t const t) {
+  return a + (t * (b - a));
+}
+
+/* Finds the cell of the input on every axis: the offset of its first corner, the distance to the next
+ * corner on each axis (0 when saturated, so the blend returns the breakpoint value) and the fractions */
+static inline int32_t interp_map_locate(float32_t const *input, interp_map_t const *map, int32_t *seg,
+                                        int32_t *step, float32_t *t) {
+  int32_t offs = 0;
+
+  for (int32_t d = 0; d < map->dims; ++d) {
+    float32_t const *axis = map->axes[d];
+    int32_t const    last = map->lengths[d] - 1; // Last breakpoint
+    int32_t          i    = 0;
+
+    step[d] = 0;
+    t[d]    = 0.0f;
+    if (input[d] >= axis[last]) { // Saturate case, also single breakpoint axes
+      i = last;
+    } else if ((0 < last) && !(input[d] <= axis[0])) { // Not saturated (a NaN propagates)
+      seg[d]  = interpolated_gallop(input[d], axis, (seg[d] < last) ? seg[d] : (last - 1), last - 1);
+      i       = seg[d];
+      step[d] = map->strides[d];
+      t[d]    = (input[d] - axis[i]) / (axis[i + 1] - axis[i]);
+    }
+    offs += i * map->strides[d];
+  }
+
+  return offs;
+}
+
+/* Blends the corners of the cell, bilinear and trilinear are unrolled */
+static inline float32_t interp_map_blend(interp_map_t const *map, int32_t offs, int32_t const *step,
+                                         float32_t const *t) {
+  float32_t const *v     = map->values + offs;
+  float32_t        value = 0.0f;
+
+  switch (map->dims) {
+    case 1:
+      value = interp_lerp(v[0], v[step[0]], t[0]);
+      break;
+
+    case 2: {
+      float32_t const r0 = interp_lerp(v[0], v[step[1]], t[1]);
+      float32_t const r1 = interp_lerp(v[step[0]], v[step[0] + step[1]], t[1]);
+
+      value = interp_lerp(r0, r1, t[0]);
+    } break;
+
+    case 3: {
+      int32_t const   s01 = step[0] + step[1];
+      float32_t const r00 = interp_lerp(v[0], v[step[2]], t[2]);
+      float32_t const r01 = interp_lerp(v[step[1]], v[step[1] + step[2]], t[2]);
+      float32_t const r10 = interp_lerp(v[step[0]], v[step[0] + step[2]], t[2]);
+      float32_t const r11 = interp_lerp(v[s01], v[s01 + step[2]], t[2]);
+
+      value = interp_lerp(interp_lerp(r00, r01, t[1]), interp_lerp(r10, r11, t[1]), t[0]);
+    } break;
+
+    default: {
+      // Corner c has the bit (dims - 1 - d) set when it's on the next breakpoint of the axis d
+      float32_t corner[1 << INTERP_MAP_MAX_DIMS];
+      int32_t   coffs[1 << INTERP_MAP_MAX_DIMS];
+      int32_t   count = 1;
+
+      coffs[0] = 0;
+      for (int32_t d = 0; d < map->dims; ++d, count <<= 1) {
+        for (int32_t k = count - 1; k >= 0; --k) {
+          coffs[(2 * k) + 1] = coffs[k] + step[d];
+          coffs[2 * k]       = coffs[k];
+        }
+      }
+      for (int32_t c = 0; c < count; ++c) {
+        corner[c] = v[coffs[c]];
+      }
+      for (int32_t d = map->dims - 1; d >= 0; --d) {
+        count >>= 1;
+        for (int32_t k = 0; k < count; ++k) {
+          corner[k] = interp_lerp(corner[2 * k], corner[(2 * k) + 1], t[d]);
+        }
+      }
+      value = corner[0];
+    } break;
+  }
+
+  return value;
+}
+
+static inline float32_t interp_map_lookup(float32_t const *input, interp_map_t const *map, int32_t *seg) {
+  int32_t       step[INTERP_MAP_MAX_DIMS];
+  float32_t     t[INTERP_MAP_MAX_DIMS];
+  int32_t const offs = interp_map_locate(input, map, seg, step, t);
+
+  return interp_map_blend(map, offs, step, t);
+}
+
+static inline bool_t interp_map_valid(interp_map_t const *map) {
+  return (NULL != map) && (NULL != map->values) && (0 < map->dims) && (INTERP_MAP_MAX_DIMS >= map->dims);
+}
+
+base_t interpolated_map_init(interp_map_t *map, float32_t const *const *axes, int32_t const *lengths,
+                             int32_t dims, float32_t const *values) {
+  base_t ret_val = NOT_OK;
+
+  bool_t valid = (NULL != map) && (NULL != axes) && (NULL != lengths) && (NULL != values) && (0 < dims) &&
+                 (INTERP_MAP_MAX_DIMS >= dims);
+
+  // Validates every axis: strictly increasing, so no cell has a width of 0
+  for (int32_t d = 0; valid && (d < dims); ++d) {
+    valid = (NULL != axes[d]) && (0 < lengths[d]);
+    for (int32_t i = 1; valid && (i < lengths[d]); ++i) {
+      valid = (axes[d][i - 1] < axes[d][i]);
+    }
+  }
+
+  if (valid) {
+    int32_t stride = 1;
+
+    for (int32_t d = dims - 1; d >= 0; --d) { // Row-major, the last axis is contiguous
+      map->axes[d]    = axes[d];
+      map->lengths[d] = lengths[d];
+      map->strides[d] = stride;
+      stride *= lengths[d];
+    }
+    map->values = values;
+    map->dims   = dims;
+    ret_val     = OK;
+  }
+
+  return ret_val;
+}
+
+float32_t interpolated_map_estimate(float32_t const *input, interp_map_t const *map) {
+  float32_t f32_range_est            = 0.0f;
+  int32_t   seg[INTERP_MAP_MAX_DIMS] = { 0 };
+
+  if ((NULL != input) && interp_map_valid(map)) {
+    f32_range_est = interp_map_lookup(input, map, seg);
+  }
+
+  return f32_range_est;
+}
+
+base_t interpolated_map_cursor_init(interp_map_cursor_t *cursor, interp_map_t const *map) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != cursor) && interp_map_valid(map)) {
+    cursor->map = map;
+    for (int32_t d = 0; d < INTERP_MAP_MAX_DIMS; ++d) {
+      cursor->seg[d] = 0;
+    }
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
+
+float32_t interpolated_map_cursor_estimate(float32_t const *input, interp_map_cursor_t *cursor) {
+  float32_t f32_range_est = 0.0f;
+
+  if ((NULL != input) && (NULL != cursor) && interp_map_valid(cursor->map)) {
+    f32_range_est = interp_map_lookup(input, cursor->map, cursor->seg);
+  }
+
+  return f32_range_est;
+}
+
+base_t interpolated_map_estimate_n(float32_t const *inputs, float32_t *outputs, int32_t n,
+                                   interp_map_t const *map) {
+  base_t  ret_val                  = NOT_OK;
+  int32_t seg[INTERP_MAP_MAX_DIMS] = { 0 }; // Each point gallops from the previous one
+
+  if ((NULL != inputs) && (NULL != outputs) && (0 <= n) && interp_map_valid(map)) {
+    for (int32_t i = 0; i < n; ++i) {
+      outputs[i] = interp_map_lookup(inputs + (i * map->dims), map, seg);
+    }
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
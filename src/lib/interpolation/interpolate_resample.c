@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file interpolate_resample.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the error-bounded uniform resampling of Linear Interpolation tables
+ *
+ * An irregular table is resampled on the smallest uniform grid that keeps the error under a bound, so its
+ * segment is found in O(1). Both the original and the resampled functions are piecewise linear and equal
+ * on the grid points, hence their max difference is at one of the original breakpoints: the error of a
+ * grid is measured in O(length) without building it.
+ */
+
+#include "interpolate.h"
+
+#define INTERP_ABS(x) (((x) < 0.0f) ? -(x) : (x))
+
+/* Grid point j of a uniform grid of n samples, the last one is exactly the end of the domain */
+static inline float32_t interp_grid_x(float32_t const *domain, int32_t length, int32_t n, int32_t j) {
+  float32_t const span = domain[length - 1] - domain[0];
+
+  return (j == n - 1) ? domain[length - 1] : (domain[0] + ((span * (float32_t)j) / (float32_t)(n - 1)));
+}
+
+/* Max error at the original breakpoints of a uniform grid of n samples */
+static float32_t interp_grid_error(float32_t const *domain, float32_t const *range, int32_t length,
+                                   int32_t n) {
+  float32_t const step    = (domain[length - 1] - domain[0]) / (float32_t)(n - 1);
+  float32_t       max_err = 0.0f;
+
+  for (int32_t i = 1; i < length - 1; ++i) {
+    int32_t j = (int32_t)((domain[i] - domain[0]) / step);
+    j         = (j < n - 2) ? j : (n - 2);
+
+    float32_t const x0  = interp_grid_x(domain, length, n, j);
+    float32_t const x1  = interp_grid_x(domain, length, n, j + 1);
+    float32_t const y0  = interpolated_estimate(x0, domain, range, length);
+    float32_t const y1  = interpolated_estimate(x1, domain, range, length);
+    float32_t const err = INTERP_ABS((y0 + (((domain[i] - x0) / (x1 - x0)) * (y1 - y0))) - range[i]);
+
+    max_err = (err > max_err) ? err : max_err;
+  }
+
+  return max_err;
+}
+
+/* Builds the table on the uniform grid of n samples, the error is measured on the built table so it
+ * includes the rounding of its slopes and intercepts */
+static base_t interp_grid_build(interp_table_t *table, float32_t *grid_domain, float32_t *grid_range,
+                                interp_seg_t *segs, float32_t const *domain, float32_t const *range,
+                                int32_t length, int32_t n, float32_t *max_err) {
+  for (int32_t j = 0; j < n; ++j) {
+    grid_domain[j] = interp_grid_x(domain, length, n, j);
+    grid_range[j]  = interpolated_estimate(grid_domain[j], domain, range, length);
+  }
+
+  base_t const ret_val = interpolated_table_init(table, segs, grid_domain, grid_range, n);
+
+  *max_err = 0.0f;
+  for (int32_t i = 0; (OK == ret_val) && (i < length); ++i) {
+    float32_t const err = INTERP_ABS(interpolated_table_estimate(domain[i], table) - range[i]);
+    *max_err            = (err > *max_err) ? err : *max_err;
+  }
+
+  return ret_val;
+}
+
+base_t interpolated_resample(interp_table_t *table, float32_t *grid_domain, float32_t *grid_range,
+                             interp_seg_t *segs, int32_t capacity, float32_t const *domain,
+                             float32_t const *range, int32_t length, float32_t max_err,
+                             interp_resample_report_t *report) {
+  base_t ret_val = NOT_OK;
+
+  bool_t valid = (NULL != table) && (NULL != grid_domain) && (NULL != grid_range) && (NULL != segs) &&
+                 (1 < capacity) && (NULL != domain) && (NULL != range) && (1 < length) && (0.0f <= max_err);
+
+  // Validates the domain: strictly increasing
+  for (int32_t i = 1; valid && (i < length); ++i) {
+    valid = (domain[i - 1] < domain[i]);
+  }
+
+  if (valid) {
+    // The error is not monotonic on the grid size (aliasing with the breakpoints), the smallest grid that
+    // meets the bound is searched linearly. Only the candidates are built
+    int32_t   n     = 1;
+    float32_t err   = 0.0f;
+    base_t    built = NOT_OK;
+
+    do {
+      ++n;
+      err   = interp_grid_error(domain, range, length, n);
+      built = NOT_OK;
+      if ((err <= max_err) || (n == capacity)) {
+        built = interp_grid_build(table, grid_domain, grid_range, segs, domain, range, length, n, &err);
+      }
+    } while (((OK != built) || (err > max_err)) && (n < capacity));
+
+    ret_val = ((OK == built) && (err <= max_err)) ? OK : NOT_OK;
+
+    if (NULL != report) {
+      report->length  = n;
+      report->max_err = err;
+      report->bytes   = (uint32_t)(((2U * sizeof(float32_t)) * (uint32_t)n) +
+                                 (sizeof(interp_seg_t) * (uint32_t)(n - 1)));
+    }
+  }
+
+  return ret_val;
+}
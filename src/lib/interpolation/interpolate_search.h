@@ -0,0 +1,106 @@
+/**
+ * @file interpolate_search.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for the segment search shared by the Linear Interpolation tables (private)
+ *
+ */
+
+#ifndef INTERPOLATE_SEARCH_H_
+#define INTERPOLATE_SEARCH_H_
+
+// Includes
+#include "utils_common.h"
+
+/* Branch-light binary search (the compiler turns the select into a cmov).
+ * Requires domain[0] <= input < domain[length-1], returns i such as domain[i] <= input < domain[i+1] */
+static inline int32_t interpolated_search(float32_t const input, float32_t const *domain, int32_t length) {
+  float32_t const *base = domain;
+
+  while (length > 1) {
+    int32_t const half = length >> 1;
+    base               = (base[half] <= input) ? (base + half) : base;
+    length -= half;
+  }
+
+  return (int32_t)(base - domain);
+}
+
+/* Gallops from the segment i towards the input (steps of 1, 2, 4...) and finishes with a binary search on
+ * the last step. Requires domain[0] < input < domain[last+1], the cost is O(log distance) */
+static inline int32_t interpolated_gallop(float32_t const input, float32_t const *domain, int32_t i,
+                                          int32_t last) {
+  int32_t lo   = i;
+  int32_t hi   = i + 1;
+  int32_t step = 1;
+
+  if (input >= domain[hi]) { // Forward, domain[lo] <= input
+    lo = hi;
+    while (((lo + step) <= last) && (domain[lo + step] <= input)) {
+      lo += step;
+      step <<= 1;
+    }
+    hi = ((lo + step) <= last) ? (lo + step) : (last + 1);
+    i  = lo + interpolated_search(input, domain + lo, hi - lo);
+  } else if (input < domain[lo]) { // Backward, domain[hi] > input
+    hi = lo;
+    while (((hi - step) >= 0) && (domain[hi - step] > input)) {
+      hi -= step;
+      step <<= 1;
+    }
+    lo = ((hi - step) >= 0) ? (hi - step) : 0;
+    i  = lo + interpolated_search(input, domain + lo, hi - lo);
+  }
+
+  return i;
+}
+
+
+/* Detects a uniformly spaced domain (strictly increasing), returns 1 / step or 0 if irregular */
+static inline float32_t interpolated_inv_step(float32_t const *domain, int32_t length) {
+  float32_t inv_step = 0.0f;
+
+  if (2 < length) {
+    float32_t const step    = (domain[length - 1] - domain[0]) / (float32_t)(length - 1);
+    float32_t const tol     = step * 1e-3f; // The lookup corrects the index, it only needs to be close
+    bool_t          uniform = (0.0f < step);
+
+    for (int32_t i = 1; uniform && (i < length - 1); ++i) {
+      float32_t const err = domain[i] - (domain[0] + (step * (float32_t)i));
+      uniform             = (err <= tol) && (err >= -tol);
+    }
+    if (uniform) inv_step = 1.0f / step;
+  }
+
+  return inv_step;
+}
+
+/* Finds the segment of the input, O(1) on a uniform domain (inv_step != 0) otherwise the binary search.
+ * Returns i such as domain[i] <= input < domain[i+1], clamped to [0, length-2] */
+static inline int32_t interpolated_find(float32_t const input, float32_t const *domain, int32_t length,
+                                        float32_t inv_step) {
+  int32_t const last = length - 2; // Last segment
+  int32_t       i    = 0;
+
+  if (0 > last) {
+    i = 0;
+  } else if (0.0f != inv_step) {
+    float32_t const pos = (input - domain[0]) * inv_step;
+
+    i = (pos > 0.0f) ? ((pos < (float32_t)last) ? (int32_t)pos : last) : 0; // NaN goes to 0
+    // Rounding on the index computation can be off by one
+    if ((0 < i) && (input < domain[i])) {
+      --i;
+    } else if ((i < last) && (input >= domain[i + 1])) {
+      ++i;
+    }
+  } else if (input >= domain[last + 1]) {
+    i = last;
+  } else if (input > domain[0]) {
+    i = interpolated_search(input, domain, last + 1);
+  }
+
+  return i;
+}
+
+#endif /* INTERPOLATE_SEARCH_H_ */
\ No newline at end of file
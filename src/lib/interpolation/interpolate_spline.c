@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file interpolate_spline.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the cubic spline (natural and monotone PCHIP) Interpolation
+ *
+ * The cubic of every segment is precomputed on the build (on float64_t) on its local coordinate, so an
+ * estimation is the same segment search of the linear tables plus a Horner evaluation. A smooth function
+ * is approximated with an error O(h^4) instead of O(h^2), the tables can be several times smaller.
+ */
+
+#include "interpolate.h"
+#include "interpolation/interpolate_search.h"
+#include <math.h>   // isnan
+#include <string.h> // memcpy
+
+#define INTERP_ABS(x) (((x) < 0.0) ? -(x) : (x))
+
+/* Derivative at an end of a PCHIP (non-centered three-point formula, shape preserving) */
+static float64_t interp_pchip_end(float64_t h0, float64_t h1, float64_t s0, float64_t s1) {
+  float64_t d = ((((2.0 * h0) + h1) * s0) - (h0 * s1)) / (h0 + h1);
+
+  if ((d * s0) <= 0.0) {
+    d = 0.0;
+  } else if (((s0 * s1) <= 0.0) && (INTERP_ABS(d) > INTERP_ABS(3.0 * s0))) {
+    d = 3.0 * s0;
+  }
+
+  return d;
+}
+
+/* Derivative at the sample i of a PCHIP (Fritsch-Carlson weighted harmonic mean, 0 on a local extremum) */
+static float64_t interp_pchip_slope(float32_t const *domain, float32_t const *range, int32_t length,
+                                    int32_t i) {
+  float64_t d = 0.0;
+
+  if (2 == length) {
+    d = ((float64_t)range[1] - range[0]) / ((float64_t)domain[1] - domain[0]);
+  } else {
+    int32_t const   j  = (0 == i) ? 1 : ((length - 1 == i) ? (length - 2) : i); // Middle sample
+    float64_t const h0 = (float64_t)domain[j] - domain[j - 1];
+    float64_t const h1 = (float64_t)domain[j + 1] - domain[j];
+    float64_t const s0 = ((float64_t)range[j] - range[j - 1]) / h0;
+    float64_t const s1 = ((float64_t)range[j + 1] - range[j]) / h1;
+
+    if (0 == i) {
+      d = interp_pchip_end(h0, h1, s0, s1);
+    } else if (length - 1 == i) {
+      d = interp_pchip_end(h1, h0, s1, s0);
+    } else if ((s0 * s1) > 0.0) {
+      float64_t const w1 = (2.0 * h1) + h0;
+      float64_t const w2 = h1 + (2.0 * h0);
+
+      d = (w1 + w2) / ((w1 / s0) + (w2 / s1));
+    }
+  }
+
+  return d;
+}
+
+static void interp_pchip_build(interp_cubic_t *cubics, float32_t const *domain, float32_t const *range,
+                               int32_t length) {
+  float64_t d0 = interp_pchip_slope(domain, range, length, 0);
+
+  for (int32_t i = 0; i < length - 1; ++i) {
+    float64_t const d1 = interp_pchip_slope(domain, range, length, i + 1);
+    float64_t const h  = (float64_t)domain[i + 1] - domain[i];
+    float64_t const s  = ((float64_t)range[i + 1] - range[i]) / h;
+
+    cubics[i].a = range[i];
+    cubics[i].b = (float32_t)d0;
+    cubics[i].c = (float32_t)(((3.0 * s) - (2.0 * d0) - d1) / h);
+    cubics[i].d = (float32_t)((d0 + d1 - (2.0 * s)) / (h * h));
+    d0          = d1;
+  }
+}
+
+/* The sweep keeps two float64_t per segment on the cubic storage (16 bytes): the eliminated coefficient on
+ * {a, b} and M on {c, d}, until the cubics are computed */
+_Static_assert(sizeof(interp_cubic_t) >= (2U * sizeof(float64_t)), "A cubic holds two float64_t");
+
+static inline float64_t interp_sweep_get(interp_cubic_t const *cubic, uint32_t const idx) {
+  float64_t val;
+  (void)memcpy(&val, (uint8_t const *)cubic + (idx * sizeof(float64_t)), sizeof(val));
+  return val;
+}
+
+static inline void interp_sweep_set(interp_cubic_t *cubic, uint32_t const idx, float64_t const val) {
+  (void)memcpy((uint8_t *)cubic + (idx * sizeof(float64_t)), &val, sizeof(val));
+}
+
+#define INTERP_SWEEP_COEF (0U)
+#define INTERP_SWEEP_M    (1U)
+
+/* Natural spline, solves the tridiagonal system of the second derivatives M (Thomas algorithm)
+ * h[i-1] M[i-1] + 2 (h[i-1] + h[i]) M[i] + h[i] M[i+1] = 6 (s[i] - s[i-1]), M[0] = M[length-1] = 0. */
+static void interp_natural_build(interp_cubic_t *cubics, float32_t const *domain, float32_t const *range,
+                                 int32_t length) {
+  int32_t const last = length - 1;
+
+  interp_sweep_set(&cubics[0], INTERP_SWEEP_COEF, 0.0);
+  interp_sweep_set(&cubics[0], INTERP_SWEEP_M, 0.0);
+  for (int32_t i = 1; i < last; ++i) {
+    float64_t const h0    = (float64_t)domain[i] - domain[i - 1];
+    float64_t const h1    = (float64_t)domain[i + 1] - domain[i];
+    float64_t const rhs   = 6.0 * ((((float64_t)range[i + 1] - range[i]) / h1) -
+                                 (((float64_t)range[i] - range[i - 1]) / h0));
+    float64_t const denom = (2.0 * (h0 + h1)) - (h0 * interp_sweep_get(&cubics[i - 1], INTERP_SWEEP_COEF));
+
+    interp_sweep_set(&cubics[i], INTERP_SWEEP_COEF, h1 / denom);
+    interp_sweep_set(&cubics[i], INTERP_SWEEP_M,
+                     (rhs - (h0 * interp_sweep_get(&cubics[i - 1], INTERP_SWEEP_M))) / denom);
+  }
+  for (int32_t i = last - 2; i > 0; --i) { // Back substitution, M[last-1] is already solved
+    float64_t const m = interp_sweep_get(&cubics[i], INTERP_SWEEP_M) -
+                        (interp_sweep_get(&cubics[i], INTERP_SWEEP_COEF) *
+                         interp_sweep_get(&cubics[i + 1], INTERP_SWEEP_M));
+    interp_sweep_set(&cubics[i], INTERP_SWEEP_M, m);
+  }
+
+  for (int32_t i = 0; i < last; ++i) {
+    float64_t const m0 = interp_sweep_get(&cubics[i], INTERP_SWEEP_M);
+    float64_t const m1 = (i + 1 < last) ? interp_sweep_get(&cubics[i + 1], INTERP_SWEEP_M) : 0.0;
+    float64_t const h  = (float64_t)domain[i + 1] - domain[i];
+    float64_t const s  = ((float64_t)range[i + 1] - range[i]) / h;
+
+    cubics[i].a = range[i];
+    cubics[i].b = (float32_t)(s - ((h * ((2.0 * m0) + m1)) / 6.0));
+    cubics[i].c = (float32_t)(m0 / 2.0);
+    cubics[i].d = (float32_t)((m1 - m0) / (6.0 * h));
+  }
+}
+
+static inline float32_t interp_spline_eval(float32_t const input, interp_spline_t const *spline, int32_t i) {
+  float32_t f32_range_est = spline->range[i]; // LUT hit, no need to interpolate
+
+  if (input != spline->domain[i]) {
+    interp_cubic_t const cub = spline->cubics[i];
+    float32_t const      t   = input - spline->domain[i];
+
+    f32_range_est = cub.a + (t * (cub.b + (t * (cub.c + (t * cub.d)))));
+  }
+
+  return f32_range_est;
+}
+
+/* Saturates out of the domain, otherwise finds the segment (from *seg on irregular domains) and evaluates */
+static inline float32_t interp_spline_lookup(float32_t const input, interp_spline_t const *spline,
+                                             int32_t *seg) {
+  int32_t const length        = spline->length;
+  float32_t     f32_range_est = 0.0f;
+
+  if (input <= spline->domain[0U]) // Saturate case
+    f32_range_est = spline->range[0U];
+
+  else if (input >= spline->domain[length - 1]) // Saturate case
+    f32_range_est = spline->range[length - 1];
+
+  else if ((1 < length) && !isnan(input)) { // A NaN is in no segment, 0 as the linear tables
+    int32_t const last = length - 2; // Last segment
+
+    if (0.0f != spline->inv_step) {
+      *seg = interpolated_find(input, spline->domain, length, spline->inv_step);
+    } else {
+      *seg = interpolated_gallop(input, spline->domain, (*seg < last) ? *seg : last, last);
+    }
+    f32_range_est = interp_spline_eval(input, spline, *seg);
+  }
+
+  return f32_range_est;
+}
+
+base_t interpolated_spline_init(interp_spline_t *spline, interp_cubic_t *cubics, float32_t const *domain,
+                                float32_t const *range, int32_t length, interp_spline_kind_t kind) {
+  base_t ret_val = NOT_OK;
+
+  bool_t valid = (NULL != spline) && (NULL != domain) && (NULL != range) && (0 < length) &&
+                 ((NULL != cubics) || (1 == length)) &&
+                 ((INTERP_SPLINE_NATURAL == kind) || (INTERP_SPLINE_PCHIP == kind));
+
+  // Validates the domain: strictly increasing, so no segment has a width of 0
+  for (int32_t i = 1; valid && (i < length); ++i) {
+    valid = (domain[i - 1] < domain[i]);
+  }
+
+  if (valid) {
+    if (1 < length) {
+      if (INTERP_SPLINE_NATURAL == kind) {
+        interp_natural_build(cubics, domain, range, length);
+      } else {
+        interp_pchip_build(cubics, domain, range, length);
+      }
+    }
+    spline->domain   = domain;
+    spline->range    = range;
+    spline->cubics   = cubics;
+    spline->length   = length;
+    spline->inv_step = interpolated_inv_step(domain, length);
+    ret_val          = OK;
+  }
+
+  return ret_val;
+}
+
+float32_t interpolated_spline_estimate(float32_t const input, interp_spline_t const *spline) {
+  float32_t f32_range_est = 0.0f;
+  int32_t   seg           = 0; // Galloping from the first segment is O(log length) as the binary search
+
+  if ((NULL != spline) && (NULL != spline->domain) && (0 < spline->length)) {
+    f32_range_est = interp_spline_lookup(input, spline, &seg);
+  }
+
+  return f32_range_est;
+}
+
+base_t interpolated_spline_estimate_n(float32_t const *inputs, float32_t *outputs, int32_t n,
+                                      interp_spline_t const *spline) {
+  base_t  ret_val = NOT_OK;
+  int32_t seg     = 0; // Each input gallops from the segment of the previous one
+
+  if ((NULL != inputs) && (NULL != outputs) && (0 <= n) && (NULL != spline) && (NULL != spline->domain) &&
+      (0 < spline->length)) {
+    for (int32_t i = 0; i < n; ++i) {
+      outputs[i] = interp_spline_lookup(inputs[i], spline, &seg);
+    }
+    ret_val = OK;
+  }
+
+  return ret_val;
+}
@@ -31,6 +31,7 @@
 
 #include "llist.h"
 #include <stdlib.h> /*malloc, free*/
+#include <string.h> /*memcpy*/
 
 static base_t llist_allocate_node(ll_node_ptr_t *new_node) {
   base_t ret_val = OK;
@@ -66,6 +67,18 @@ ll_node_ptr_t llist_create_node(void *data, uint32_t data_size) {
   return new_node;
 }
 
+ll_node_ptr_t llist_wrap_node(void *data) {
+
+  ll_node_t *new_node = NULL;
+
+  if ((NULL != data) && (OK == llist_allocate_node(&new_node))) {
+    new_node->data = data;
+    new_node->next = NULL;
+  }
+
+  return new_node;
+}
+
 base_t llist_push_head(ll_handle_t *head, ll_node_ptr_t node) {
   base_t ret_val = OK;
 
@@ -179,6 +192,83 @@ uint32_t llist_get_size(ll_handle_t head) {
   return size;
 }
 
+ll_node_ptr_t llist_get_tail(ll_handle_t head) {
+  ll_node_ptr_t tail = head;
+
+  while ((NULL != tail) && (NULL != tail->next)) {
+    tail = tail->next;
+  }
+
+  return tail;
+}
+
+base_t llist_splice(ll_handle_t *dst_link, ll_handle_t *src_link, ll_node_ptr_t last) {
+  base_t ret_val = OK;
+
+  if ((NULL != dst_link) && (NULL != src_link) && (NULL != *src_link) && (NULL != last)) {
+    ll_node_ptr_t const first = *src_link;
+
+    *src_link  = last->next; // Close the gap on the source
+    last->next = *dst_link;
+    *dst_link  = first;
+  } else {
+    ret_val = NOT_OK;
+  }
+
+  return ret_val;
+}
+
+base_t llist_concat(ll_handle_t *head, ll_handle_t *src) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != head) && (NULL != src) && (NULL != *src) && (*head != *src)) {
+    ll_node_ptr_t const tail = llist_get_tail(*head);
+
+    ret_val = llist_splice((NULL == tail) ? head : &tail->next, src, llist_get_tail(*src));
+  }
+
+  return ret_val;
+}
+
+base_t llist_split_at(ll_handle_t *head, uint32_t pos, ll_handle_t *rest) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != head) && (NULL != rest) && (NULL == *rest)) {
+    ll_handle_t *link = head;
+
+    while ((0 != pos) && (NULL != *link)) {
+      link = &(*link)->next;
+      --pos;
+    }
+    if (NULL != *link) {
+      *rest   = *link;
+      *link   = NULL;
+      ret_val = OK;
+    }
+  }
+
+  return ret_val;
+}
+
+base_t llist_split_if(ll_handle_t *head, ll_visit_fn_t vfn_ptr, void *ctx, ll_handle_t *rest) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != head) && (NULL != vfn_ptr) && (NULL != rest) && (NULL == *rest)) {
+    ll_handle_t *link = head;
+
+    while ((NULL != *link) && (OK == (*vfn_ptr)((*link)->data, ctx))) {
+      link = &(*link)->next;
+    }
+    if (NULL != *link) {
+      *rest   = *link;
+      *link   = NULL;
+      ret_val = OK;
+    }
+  }
+
+  return ret_val;
+}
+
 void llist_traverse(ll_handle_t const head, void (*vfn_ptr)(void *)) {
   ll_node_ptr_t node_ref = head;
 
@@ -188,4 +278,85 @@ void llist_traverse(ll_handle_t const head, void (*vfn_ptr)(void *)) {
     node_ref = node_ref->next;
   }
   (*vfn_ptr)(NULL); // Notify the end of the list
+}
+
+ll_node_ptr_t llist_traverse_ctx(ll_handle_t const head, ll_visit_fn_t vfn_ptr, void *ctx) {
+  ll_node_ptr_t node_ref = head;
+
+  if (NULL != vfn_ptr) {
+    while (NULL != node_ref) {
+      ll_node_ptr_t const next = node_ref->next;
+
+      // Hide the pointer chasing latency behind the visitor
+      if (NULL != next) {
+        LLIST_PREFETCH(next->next);
+        LLIST_PREFETCH(next->data);
+      }
+      if (OK != (*vfn_ptr)(node_ref->data, ctx)) break;
+
+      node_ref = next;
+    }
+  }
+
+  return node_ref;
+}
+
+base_t llist_compact(ll_handle_t *head, uint32_t data_size, ll_block_t *block) {
+  base_t         ret_val = NOT_OK;
+  uint32_t const count   = llist_get_size(*head);
+
+  if ((0 != count) && (0 != data_size) && (NULL != block)) {
+    // Payloads start on a 16 bytes boundary after the nodes
+    size_t const nodes_sz = ((count * sizeof(ll_node_t)) + 15U) & ~(size_t)15U;
+    uint8_t     *mem      = (uint8_t *)malloc(nodes_sz + ((size_t)count * data_size));
+
+    if (NULL != mem) {
+      ll_node_ptr_t nodes   = (ll_node_ptr_t)mem;
+      uint8_t      *data    = mem + nodes_sz;
+      ll_node_ptr_t current = *head;
+
+      for (uint32_t i = 0; i < count; ++i) {
+        ll_node_ptr_t const next = current->next;
+
+        (void)memcpy(data + ((size_t)i * data_size), current->data, data_size);
+        nodes[i].data = data + ((size_t)i * data_size);
+        nodes[i].next = ((i + 1) < count) ? &nodes[i + 1] : NULL;
+        llist_delete_node(current);
+
+        current = next;
+      }
+
+      block->nodes     = nodes;
+      block->data      = data;
+      block->count     = count;
+      block->data_size = data_size;
+      *head            = nodes;
+      ret_val          = OK;
+    }
+  }
+
+  return ret_val;
+}
+
+void llist_delete_compact(ll_handle_t *head, ll_block_t *block) {
+  ll_node_ptr_t current = *head;
+
+  while (NULL != current) {
+    ll_node_ptr_t const next = current->next;
+
+    // Only the nodes pushed after the compaction have their own allocation
+    if ((NULL == block) || (current < block->nodes) || (current >= (block->nodes + block->count))) {
+      llist_delete_node(current);
+    }
+    current = next;
+  }
+  *head = NULL;
+
+  if (NULL != block) {
+    free(block->nodes);
+    block->nodes     = NULL;
+    block->data      = NULL;
+    block->count     = 0;
+    block->data_size = 0;
+  }
 }
\ No newline at end of file
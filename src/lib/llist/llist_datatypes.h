@@ -26,6 +26,17 @@ struct ll_node_s {
   void      *data; // Any data type
 };
 
+/* Single allocation holding a compacted list: nodes and payloads in traversal order */
+typedef struct ll_block_s {
+  ll_node_t *nodes;     // nodes[i].next == &nodes[i + 1]
+  void      *data;      // Read-only array view of the payloads, `data_size` bytes each
+  uint32_t   count;     // Number of nodes (and payloads)
+  uint32_t   data_size; // Payload size
+} ll_block_t;
+
+/* Visitor with user context. Returning other than OK stops the traversal */
+typedef base_t (*ll_visit_fn_t)(void *data, void *ctx);
+
 #ifdef __cplusplus
 }
 #endif
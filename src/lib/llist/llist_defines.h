@@ -13,6 +13,12 @@
 extern "C" {
 #endif
 
+#if defined(__GNUC__)
+  #define LLIST_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+  #define LLIST_PREFETCH(addr) ((void)(addr))
+#endif
+
 #define _LLIST_DEF_TYPE(type, list)                                 \
   type llist_pop_head_data_##list(ll_handle_t *head) {              \
     type *_ptr = (type *)llist_pop_head_data(head);                 \
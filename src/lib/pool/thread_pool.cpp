@@ -0,0 +1,143 @@
+/**
+ * @file thread_pool.cpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for the work-stealing Thread Pool workers
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#include "thread_pool.hpp"
+
+namespace c_utils {
+
+struct ThreadPool::Worker {
+  WsDeque<detail::PoolTask *, THREAD_POOL_LOCAL_TASKS> tasks;
+  std::thread                                          thread;
+  ThreadPool                                          *pool  = nullptr;
+  std::size_t                                          index = 0;
+};
+
+thread_local ThreadPool::Worker *ThreadPool::_current = nullptr;
+
+ThreadPool::ThreadPool(std::size_t workers)
+    : _count((0 < workers) ? workers : 1), _workers(new Worker[(0 < workers) ? workers : 1]) {
+  for (std::size_t i = 0; i < _count; ++i) {
+    _workers[i].pool  = this;
+    _workers[i].index = i;
+  }
+  // Deques are ready before any worker may try to steal from them
+  for (std::size_t i = 0; i < _count; ++i) {
+    _workers[i].thread = std::thread(&ThreadPool::work, this, &_workers[i]);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  _stop.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  _epoch.fetch_add(1, std::memory_order_release);
+  detail::atomic_notify_all(_epoch);
+  for (std::size_t i = 0; i < _count; ++i) _workers[i].thread.join();
+}
+
+ThreadPool::Worker *ThreadPool::current() const {
+  return ((nullptr != _current) && (this == _current->pool)) ? _current : nullptr;
+}
+
+bool ThreadPool::hungry() const {
+  Worker const *worker = current();
+  return (nullptr == worker) || worker->tasks.empty();
+}
+
+void ThreadPool::wake() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (0 < _sleepers.load(std::memory_order_relaxed)) {
+    _epoch.fetch_add(1, std::memory_order_release);
+    detail::atomic_notify_all(_epoch);
+  }
+}
+
+void ThreadPool::push(detail::PoolTask *task) {
+  Worker *worker = current();
+  if (nullptr == worker) {
+    _shared.wait_enqueue(task);
+  } else if (!worker->tasks.push(task)) {
+    task->run(task); // Local deque full, the work is already spread enough
+    return;
+  }
+  wake();
+}
+
+bool ThreadPool::find(Worker *worker, detail::PoolTask *&task) {
+  if ((nullptr != worker) && worker->tasks.pop(task)) return true;
+  if (_shared.try_dequeue(task)) return true;
+
+  // Steal from the other workers, starting next to this one to spread the thieves
+  std::size_t const first = (nullptr != worker) ? worker->index + 1 : 0;
+  for (std::size_t i = 0; i < _count; ++i) {
+    Worker &victim = _workers[(first + i) % _count];
+    if ((&victim != worker) && victim.tasks.steal(task)) return true;
+  }
+  return false;
+}
+
+bool ThreadPool::run_one(Worker *worker) {
+  detail::PoolTask *task = nullptr;
+  bool const        found = find(worker, task);
+  if (found) task->run(task);
+  return found;
+}
+
+void ThreadPool::wait(WaitGroup &group) {
+  Worker *worker = current();
+  if (nullptr == worker) {
+    group.wait();
+    return;
+  }
+  while (!group.idle()) {
+    if (!run_one(worker)) std::this_thread::yield();
+  }
+}
+
+void ThreadPool::work(Worker *worker) {
+  _current = worker;
+  for (;;) {
+    if (run_one(worker)) continue;
+
+    // Announce the sleep before the last look, a push after it sees the sleeper and bumps the epoch
+    _sleepers.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t const epoch = _epoch.load(std::memory_order_acquire);
+    bool const     found = run_one(worker);
+    bool const     stop  = !found && _stop.load(std::memory_order_relaxed);
+    if (!found && !stop) detail::atomic_wait(_epoch, epoch);
+    _sleepers.fetch_sub(1, std::memory_order_relaxed);
+    if (stop) break;
+  }
+  _current = nullptr;
+}
+
+} // namespace c_utils
@@ -0,0 +1,184 @@
+/**
+ * @file thread_pool.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define a fixed-size work-stealing Thread Pool and its Wait Groups
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef THREAD_POOL_HPP_
+#define THREAD_POOL_HPP_
+
+#include "pool/ws_deque.hpp"
+#include "queue/mpmc_queue.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// Tasks each worker keeps on its local deque, a full deque runs the new tasks inline
+#ifndef THREAD_POOL_LOCAL_TASKS
+#define THREAD_POOL_LOCAL_TASKS (1024)
+#endif
+// Tasks submitted from outside the pool waiting for a worker, a full queue blocks the submitter
+#ifndef THREAD_POOL_SHARED_TASKS
+#define THREAD_POOL_SHARED_TASKS (1024)
+#endif
+// Tasks per worker parallel_for aims for when no grain is given
+#ifndef THREAD_POOL_SPLIT_FACTOR
+#define THREAD_POOL_SPLIT_FACTOR (8)
+#endif
+
+namespace c_utils {
+
+// Counter of pending tasks, wait() blocks until all of them are done.
+class WaitGroup {
+public:
+  explicit WaitGroup() = default;
+  WaitGroup(WaitGroup const &)            = delete;
+  WaitGroup &operator=(WaitGroup const &) = delete;
+
+  void add(uint32_t count = 1) {
+    _count.fetch_add(count, std::memory_order_relaxed);
+  }
+  void done() {
+    if (1 == _count.fetch_sub(1, std::memory_order_acq_rel)) detail::atomic_notify_all(_count);
+  }
+  bool idle() const {
+    return (0 == _count.load(std::memory_order_acquire));
+  }
+  void wait() {
+    for (uint32_t count = _count.load(std::memory_order_acquire); 0 != count;
+         count          = _count.load(std::memory_order_acquire)) {
+      detail::atomic_wait(_count, count);
+    }
+  }
+
+private:
+  std::atomic<uint32_t> _count{ 0 };
+};
+
+namespace detail {
+// Type erased task, runs and releases itself
+struct PoolTask {
+  void (*run)(PoolTask *task);
+};
+template <class F> struct PoolTaskImpl : PoolTask {
+  F fn;
+
+  explicit PoolTaskImpl(F &&fn_) : PoolTask{ &PoolTaskImpl::call }, fn(std::move(fn_)) {}
+  static void call(PoolTask *task) {
+    std::unique_ptr<PoolTaskImpl> self(static_cast<PoolTaskImpl *>(task));
+    self->fn();
+  }
+};
+} // namespace detail
+
+// Fixed number of workers, each one with a local Chase-Lev deque. Tasks submitted by a worker go to its own
+// deque, tasks from other threads go to a shared MpmcQueue. An idle worker takes work from its deque, then
+// the shared queue, then steals from the other workers, and sleeps when there is nothing left.
+//   c_utils::ThreadPool pool(4);
+//   pool.parallel_for(0, n, [&](std::size_t i) { out[i] = interpolated_estimate(in[i], x, y, len); });
+class ThreadPool {
+public:
+  explicit ThreadPool(std::size_t workers = std::thread::hardware_concurrency());
+  ThreadPool(ThreadPool const &)            = delete;
+  ThreadPool &operator=(ThreadPool const &) = delete;
+  // Runs the pending tasks and joins the workers
+  ~ThreadPool();
+
+  std::size_t size() const {
+    return _count;
+  }
+
+  template <class F> void submit(F &&fn) {
+    using Task = detail::PoolTaskImpl<typename std::decay<F>::type>;
+    push(new Task(typename std::decay<F>::type(std::forward<F>(fn))));
+  }
+  // Tracks the task on the wait group
+  template <class F> void submit(WaitGroup &group, F &&fn) {
+    group.add();
+    submit([&group, fn = typename std::decay<F>::type(std::forward<F>(fn))]() mutable {
+      fn();
+      group.done();
+    });
+  }
+
+  // Waits for the group; a worker keeps running tasks meanwhile so nested waits don't starve the pool
+  void wait(WaitGroup &group);
+
+  // Calls fn(i) for every i in [begin, end) and waits for all of them. The range is split lazily: a task
+  // keeps handing out the upper half of its range while its worker deque is empty (other workers are
+  // hungry), down to grain iterations (default: range / (workers * THREAD_POOL_SPLIT_FACTOR)).
+  template <class F> void parallel_for(std::size_t begin, std::size_t end, F &&fn, std::size_t grain = 0) {
+    if (begin >= end) return;
+    if (0 == grain) grain = (end - begin) / (_count * THREAD_POOL_SPLIT_FACTOR);
+    if (0 == grain) grain = 1;
+
+    WaitGroup group;
+    for_range(group, begin, end, grain, fn);
+    wait(group);
+  }
+
+private:
+  struct Worker;
+
+  std::size_t                                             _count;
+  std::unique_ptr<Worker[]>                               _workers;
+  MpmcQueue<detail::PoolTask *, THREAD_POOL_SHARED_TASKS> _shared;
+  alignas(cache_line_size) std::atomic<uint32_t>          _epoch{ 0 }; // bumped to wake the sleepers
+  std::atomic<uint32_t>                                   _sleepers{ 0 };
+  std::atomic<bool>                                       _stop{ false };
+  static thread_local Worker                             *_current; // worker on the calling thread (any pool)
+
+  void push(detail::PoolTask *task);
+  bool run_one(Worker *worker);
+  bool find(Worker *worker, detail::PoolTask *&task);
+  void work(Worker *worker);
+  void wake();
+  // Worker of this pool running on the calling thread, nullptr otherwise
+  Worker *current() const;
+  // True when the worker running on the calling thread has nothing queued (always for other threads)
+  bool hungry() const;
+
+  template <class F>
+  void for_range(WaitGroup &group, std::size_t begin, std::size_t end, std::size_t grain, F &fn) {
+    while ((end - begin > grain) && hungry()) {
+      std::size_t const mid = begin + (end - begin) / 2;
+      submit(group, [this, &group, mid, end, grain, &fn]() { for_range(group, mid, end, grain, fn); });
+      end = mid;
+    }
+    for (; begin < end; ++begin) fn(begin);
+  }
+};
+
+} // namespace c_utils
+
+#endif /* THREAD_POOL_HPP_ */
@@ -0,0 +1,131 @@
+/**
+ * @file ws_deque.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define a Chase-Lev work-stealing deque
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef WS_DEQUE_HPP_
+#define WS_DEQUE_HPP_
+
+#include "queue/queue_defines.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace c_utils {
+
+// Bounded Chase-Lev deque (Le et al. C11 ordering). The owner thread pushes and pops at the bottom (LIFO, hot
+// in cache) and any other thread steals from the top (FIFO, the oldest and usually the largest work). Only
+// the race for the last element and the steals use a CAS on top. Elements are copied in/out of atomic slots,
+// meant for pointers or small handles.
+template <class T, std::size_t max_size> class WsDeque {
+  static_assert((max_size > 0) && (0 == (max_size & (max_size - 1))), "Capacity shall be a power of 2");
+  static_assert(std::is_trivially_copyable<T>::value, "Elements are copied through atomic slots");
+
+private:
+  alignas(cache_line_size) std::atomic<int64_t> _top{ 0 };    // thieves side
+  alignas(cache_line_size) std::atomic<int64_t> _bottom{ 0 }; // owner side
+  alignas(cache_line_size) std::atomic<T> _buff[max_size];
+
+  static constexpr int64_t mask = static_cast<int64_t>(max_size - 1);
+
+public:
+  explicit WsDeque() = default;
+  WsDeque(WsDeque const &)            = delete;
+  WsDeque &operator=(WsDeque const &) = delete;
+
+  // Approximate when called while other threads are running
+  std::size_t size() const {
+    int64_t const bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t const top    = _top.load(std::memory_order_relaxed);
+    return (bottom > top) ? static_cast<std::size_t>(bottom - top) : 0;
+  }
+  bool empty() const {
+    return (0 == size());
+  }
+  static constexpr std::size_t capacity() {
+    return max_size;
+  }
+
+  // Owner: inserts a new(est) element on the bottom if the deque is not full.
+  bool push(T const &val) {
+    int64_t const bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t const top    = _top.load(std::memory_order_acquire);
+    if (bottom - top >= static_cast<int64_t>(max_size)) return false;
+
+    _buff[bottom & mask].store(val, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_release); // Publishes the slot to the thieves
+    return true;
+  }
+
+  // Owner: removes the newest element from the bottom.
+  bool pop(T &element) {
+    int64_t const bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top   = _top.load(std::memory_order_relaxed);
+    bool    is_ok = false;
+
+    if (top <= bottom) {
+      element = _buff[bottom & mask].load(std::memory_order_relaxed);
+      is_ok   = true;
+      if (top == bottom) {
+        // Last element, race against the thieves for it
+        is_ok = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return is_ok;
+  }
+
+  // Thieves: removes the oldest element from the top, fails when empty or when losing the race for it.
+  bool steal(T &element) {
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t const bottom = _bottom.load(std::memory_order_acquire);
+    bool          is_ok  = false;
+
+    if (top < bottom) {
+      T const val = _buff[top & mask].load(std::memory_order_relaxed);
+      if (_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        element = val;
+        is_ok   = true;
+      }
+    }
+    return is_ok;
+  }
+};
+
+} // namespace c_utils
+
+#endif /* WS_DEQUE_HPP_ */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file pqueue.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for Priority queue implementation, a 4-ary heap on a fixed buffer
+ *
+ * @see https://en.wikipedia.org/wiki/D-ary_heap
+ */
+
+#include "pqueue.h"
+#include <string.h> // memcpy
+
+static inline uint8_t *pq_slot(pqueue_handle_t pq, uint32_t idx) {
+  return (uint8_t *)pq->vBuff + (size_t)idx * pq->u16_eSize;
+}
+
+// The sifts move a hole instead of swapping: the sifted element waits on the scratch slot (past the last
+// slot of the heap) and it's written once when its place is found.
+static void pq_sift_up(pqueue_handle_t pq, uint32_t idx) {
+  uint8_t *const scratch = pq_slot(pq, pq->u16_lgth);
+
+  while (0U < idx) {
+    uint32_t const parent = (idx - 1U) / PQUEUE_ARITY;
+
+    if (!pq->cmp(scratch, pq_slot(pq, parent))) {
+      break;
+    }
+    memcpy(pq_slot(pq, idx), pq_slot(pq, parent), pq->u16_eSize);
+    idx = parent;
+  }
+  memcpy(pq_slot(pq, idx), scratch, pq->u16_eSize);
+}
+
+static void pq_sift_down(pqueue_handle_t pq, uint32_t idx) {
+  uint8_t *const scratch = pq_slot(pq, pq->u16_lgth);
+  uint32_t const count   = pq->u16_count;
+
+  for (uint32_t first = idx * PQUEUE_ARITY + 1U; first < count; first = idx * PQUEUE_ARITY + 1U) {
+    uint32_t const last = (first + PQUEUE_ARITY < count) ? first + PQUEUE_ARITY : count;
+    uint32_t       best = first;
+
+    for (uint32_t child = first + 1U; child < last; ++child) {
+      if (pq->cmp(pq_slot(pq, child), pq_slot(pq, best))) {
+        best = child;
+      }
+    }
+    if (!pq->cmp(pq_slot(pq, best), scratch)) {
+      break;
+    }
+    memcpy(pq_slot(pq, idx), pq_slot(pq, best), pq->u16_eSize);
+    idx = best;
+  }
+  memcpy(pq_slot(pq, idx), scratch, pq->u16_eSize);
+}
+
+base_t pqueue_init(pqueue_handle_t pq, void *const buffer, uint16_t const length, uint16_t const element_sz,
+                   pq_cmp_fn_t const cmp) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != pq) && (NULL != buffer) && (length) && (element_sz) && (NULL != cmp)) {
+    void       **buff_ref = (void **)&pq->vBuff;
+    pq_cmp_fn_t *cmp_ref  = (pq_cmp_fn_t *)&pq->cmp;
+    uint16_t    *elem_sz  = (uint16_t *)&pq->u16_eSize;
+    uint16_t    *buff_len = (uint16_t *)&pq->u16_lgth;
+
+    // assignation of the members through pointers
+    *buff_ref = buffer;
+    *cmp_ref  = cmp;
+    *buff_len = length;
+    *elem_sz  = element_sz;
+    ret_val   = pqueue_reset(pq);
+  }
+  return ret_val;
+}
+
+base_t pqueue_reset(pqueue_handle_t pq) {
+  base_t ret_val = NOT_OK;
+
+  if (NULL != pq) {
+    pq->u16_count = 0U;
+    ret_val       = OK;
+  }
+  return ret_val;
+}
+
+base_t pqueue_push(pqueue_handle_t pq, void *const element) {
+  base_t ret_val = OK;
+
+  if ((NULL == pq) || (NULL == element)) {
+    ASSERT(pq && element);
+    ret_val = NOT_OK;
+  } else if (pq->u16_count == pq->u16_lgth) {
+    ret_val = NOT_OK;
+  } else {
+    memcpy(pq_slot(pq, pq->u16_lgth), element, pq->u16_eSize);
+    pq_sift_up(pq, pq->u16_count++);
+  }
+  return ret_val;
+}
+
+base_t pqueue_pop(pqueue_handle_t pq, void *element, bool_t const rd_only) {
+  base_t ret_val = OK;
+
+  if ((NULL == pq) || (NULL == element)) {
+    ASSERT(pq && element);
+    ret_val = NOT_OK;
+  } else if (0U == pq->u16_count) {
+    ret_val = NOT_OK;
+  } else {
+    memcpy(element, pq_slot(pq, 0U), pq->u16_eSize);
+
+    if (!rd_only && (0U < --pq->u16_count)) {
+      // The last element fills the root hole and it's sifted down
+      memcpy(pq_slot(pq, pq->u16_lgth), pq_slot(pq, pq->u16_count), pq->u16_eSize);
+      pq_sift_down(pq, 0U);
+    }
+  }
+  return ret_val;
+}
+
+base_t pqueue_heapify(pqueue_handle_t pq, void *const elements, uint16_t const count) {
+  base_t ret_val = OK;
+
+  if ((NULL == pq) || ((NULL == elements) && (count))) {
+    ASSERT(pq && (elements || !count));
+    ret_val = NOT_OK;
+  } else if ((uint32_t)pq->u16_count + count > pq->u16_lgth) {
+    ret_val = NOT_OK;
+  } else if (count) {
+    memcpy(pq_slot(pq, pq->u16_count), elements, (size_t)count * pq->u16_eSize);
+    pq->u16_count += count;
+
+    // Floyd: sift down every parent from the last one to the root, the leaves are already heaps
+    for (uint32_t idx = (pq->u16_count - 1U + PQUEUE_ARITY - 1U) / PQUEUE_ARITY; 0U < idx--;) {
+      memcpy(pq_slot(pq, pq->u16_lgth), pq_slot(pq, idx), pq->u16_eSize);
+      pq_sift_down(pq, idx);
+    }
+  }
+  return ret_val;
+}
+
+uint16_t pqueue_size(pqueue_handle_t pq) {
+  uint16_t ret_val = 0U;
+
+  if (NULL != pq) {
+    ret_val = pq->u16_count;
+  }
+  return ret_val;
+}
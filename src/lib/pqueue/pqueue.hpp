@@ -0,0 +1,213 @@
+/**
+ * @file pqueue.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for the C++ Priority queue (4-ary heap) on fixed storage
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef PQUEUE_HPP_
+#define PQUEUE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace c_utils {
+
+// Bounded priority queue on raw slots, a 4-ary heap like the C API (pqueue.h) but the comparator is inlined
+// and the elements are moved instead of copied byte-wise. Same order as std::priority_queue: with the default
+// std::less the top is the greatest element.
+template <class T, uint16_t max_size, class Cmp = std::less<T>> class PriorityQueue {
+  static_assert(max_size > 0, "A priority queue needs at least 1 slot");
+
+private:
+  static constexpr uint32_t arity = 4U;
+
+  alignas(T) unsigned char _buff[max_size][sizeof(T)];
+  uint16_t _count = 0;
+  Cmp      _cmp;
+
+  T *slot(uint32_t idx) {
+    return std::launder(reinterpret_cast<T *>(_buff[idx]));
+  }
+  T const *slot(uint32_t idx) const {
+    return std::launder(reinterpret_cast<T const *>(_buff[idx]));
+  }
+
+  // The sifts move a hole instead of swapping, the sifted element is moved out once and back at its place
+  void sift_up(uint32_t idx) {
+    T val = std::move(*slot(idx));
+    while (0U < idx) {
+      uint32_t const parent = (idx - 1U) / arity;
+      if (!_cmp(*slot(parent), val)) break;
+      *slot(idx) = std::move(*slot(parent));
+      idx        = parent;
+    }
+    *slot(idx) = std::move(val);
+  }
+
+  void sift_down(uint32_t idx) {
+    T val = std::move(*slot(idx));
+    for (uint32_t first = idx * arity + 1U; first < _count; first = idx * arity + 1U) {
+      uint32_t const last = (first + arity < _count) ? first + arity : _count;
+      uint32_t       best = first;
+      for (uint32_t child = first + 1U; child < last; ++child) {
+        if (_cmp(*slot(best), *slot(child))) best = child;
+      }
+      if (!_cmp(val, *slot(best))) break;
+      *slot(idx) = std::move(*slot(best));
+      idx        = best;
+    }
+    *slot(idx) = std::move(val);
+  }
+
+  // Floyd: sift down every parent from the last one to the root, the leaves are already heaps
+  void heapify() {
+    for (uint32_t idx = (_count + arity - 2U) / arity; 0U < idx--;) {
+      sift_down(idx);
+    }
+  }
+
+  // Moves the last element to the root hole and sifts it down, the queue can't be empty
+  void remove_top() {
+    T *last = slot(--_count);
+    if (0U < _count) *slot(0) = std::move(*last);
+    last->~T();
+    if (1U < _count) sift_down(0);
+  }
+
+  // The heap order holds on the copied or moved slots, no need to re-sift
+  template <class Q> void insert_from(Q &&other) {
+    for (uint16_t i = 0; i < other._count; ++i) {
+      if constexpr (std::is_lvalue_reference<Q>::value) {
+        ::new (static_cast<void *>(_buff[i])) T(*other.slot(i));
+      } else {
+        ::new (static_cast<void *>(_buff[i])) T(std::move(*other.slot(i)));
+      }
+      _count = static_cast<uint16_t>(i + 1U);
+    }
+  }
+
+public:
+  PriorityQueue() = default;
+  explicit PriorityQueue(Cmp const &cmp) : _cmp(cmp) {}
+  PriorityQueue(PriorityQueue const &other) : _cmp(other._cmp) {
+    insert_from(other);
+  }
+  PriorityQueue(PriorityQueue &&other) : _cmp(other._cmp) {
+    insert_from(std::move(other));
+  }
+  PriorityQueue &operator=(PriorityQueue const &other) {
+    if (this != &other) {
+      clear();
+      _cmp = other._cmp;
+      insert_from(other);
+    }
+    return *this;
+  }
+  PriorityQueue &operator=(PriorityQueue &&other) {
+    if (this != &other) {
+      clear();
+      _cmp = other._cmp;
+      insert_from(std::move(other));
+    }
+    return *this;
+  }
+  ~PriorityQueue() {
+    clear();
+  }
+
+  bool empty() const {
+    return 0U == _count;
+  }
+  bool full() const {
+    return max_size == _count;
+  }
+  // return the size of the current elements
+  uint16_t size() const {
+    return _count;
+  }
+
+  // Destroys all the elements
+  void clear() {
+    for (uint16_t i = 0; i < _count; ++i) slot(i)->~T();
+    _count = 0;
+  }
+
+  // First (highest priority) element, the queue shall not be empty
+  T const &top() const {
+    return *slot(0);
+  }
+
+  // Constructs a new element in place and sifts it up to its place, O(log n). False if the queue is full.
+  template <class... Args> bool emplace(Args &&...args) {
+    if (full()) return false;
+    ::new (static_cast<void *>(_buff[_count])) T(std::forward<Args>(args)...);
+    sift_up(_count++);
+    return true;
+  }
+  bool push(T const &val) {
+    return emplace(val);
+  }
+  bool push(T &&val) {
+    return emplace(std::move(val));
+  }
+
+  // removes the first (highest priority) element, O(log n)
+  bool pop() {
+    if (empty()) return false;
+    remove_top();
+    return true;
+  }
+  // Provides (moved) as a reference on the in/out element arg the first (highest priority) element
+  bool pop(T &element) {
+    if (empty()) return false;
+    element = std::move(*slot(0));
+    remove_top();
+    return true;
+  }
+
+  // Inserts (copied) up to count elements, as many as free slots, and rebuilds the heap bottom-up in O(n)
+  // instead of O(count log n) of pushing them one by one. Returns the inserted count.
+  uint16_t push_bulk(T const *elements, uint16_t count) {
+    uint16_t const n = std::min<uint16_t>(count, static_cast<uint16_t>(max_size - _count));
+    for (uint16_t i = 0; i < n; ++i) {
+      ::new (static_cast<void *>(_buff[_count])) T(elements[i]);
+      ++_count;
+    }
+    if (0U < n) heapify();
+    return n;
+  }
+};
+
+} // namespace c_utils
+
+#endif /* PQUEUE_HPP_ */
@@ -0,0 +1,27 @@
+/**
+ * @file pqueue_datatypes.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Priority queue (d-ary heap) datatypes definition
+ *
+ */
+
+#ifndef PQUEUE_DATATYPES_H_
+#define PQUEUE_DATATYPES_H_
+
+// Includes
+#include "utils_common.h"
+
+// Returns true when the element a shall be popped before the element b (has higher priority)
+typedef bool_t (*pq_cmp_fn_t)(void const *a, void const *b);
+
+typedef struct pqueue_s {
+  void *const       vBuff;     // Will hold the heap ref, length + 1 elements (last one is the sift scratch)
+  pq_cmp_fn_t const cmp;       // Priority order of the elements
+  uint16_t const    u16_eSize; // Element size
+  uint16_t const    u16_lgth;  // Max length heap capacity
+  uint16_t          u16_count; // Current number of elements
+
+} pqueue_t;
+
+#endif /* PQUEUE_DATATYPES_H_ */
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @file pqueue_defines.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Priority queue (d-ary heap) definitions and macros
+ *
+ */
+
+#ifndef PQUEUE_DEFINES_H_
+#define PQUEUE_DEFINES_H_
+
+#define CHECK_NULL_ASSERT (DISABLE)
+
+#if !(CHECK_NULL_ASSERT)
+  #undef ASSERT
+  #define ASSERT(expr)
+#else
+  #include <assert.h>
+#endif
+
+// Children per node, the 4 children of a node are contiguous so a sift down level compares them within
+// one or two cache lines, and the heap is half as deep as a binary one
+#define PQUEUE_ARITY (4U)
+
+// clang-format off
+
+#define __PQUEUE_TYPE(type, pq, size)       \
+  type pq ## pqueue[(size) + 1];            \
+  pqueue_t pq = {                           \
+    .vBuff = pq ## pqueue,                  \
+    .cmp   = pq ## _cmp_refd,               \
+    .u16_eSize = sizeof(type),              \
+    .u16_lgth  = size,                      \
+    .u16_count = 0U,                        \
+  };
+
+#define _PQUEUE_DEF_TYPE(type, pq, size, cmp_fn)            \
+    static bool_t pq ## _cmp_refd(void const *a, void const *b) \
+    {                                                       \
+        return cmp_fn((type const *)a, (type const *)b);    \
+    }                                                       \
+        __PQUEUE_TYPE(type, pq, size)                       \
+    base_t pq ## _push_refd(type *pt)                       \
+    {                                                       \
+        return pqueue_push(&pq, pt);                        \
+    }                                                       \
+    base_t pq ## _pop_refd(type *pt)                        \
+    {                                                       \
+        return pqueue_pop(&pq, pt, 0);                      \
+    }                                                       \
+    base_t pq ## _top_refd(type *pt)                        \
+    {                                                       \
+        return pqueue_pop(&pq, pt, 1);                      \
+    }                                                       \
+    base_t pq ## _heapify_refd(type *pt, uint16_t count)    \
+    {                                                       \
+        return pqueue_heapify(&pq, pt, count);              \
+    }
+// clang-format on
+#endif /* PQUEUE_DEFINES_H_ */
\ No newline at end of file
@@ -0,0 +1,371 @@
+/**
+ * @file async_channel.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define a coroutine awaitable Channel on top of the Queue class (C++20)
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef ASYNC_CHANNEL_HPP_
+#define ASYNC_CHANNEL_HPP_
+
+#if !defined(__cpp_impl_coroutine)
+#error "async_channel.hpp needs C++20 coroutines, configure with -DENABLE_CXX20=ON"
+#endif
+
+#include "queue/queue.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <optional>
+#include <utility>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+// Coroutines the scheduler keeps ready to run, a full ready queue resumes the coroutine inline
+#ifndef SCHEDULER_READY_SLOTS
+#define SCHEDULER_READY_SLOTS (1024)
+#endif
+// Coroutine frames recycled per thread: size classes of FRAME_POOL_GRAIN bytes up to FRAME_POOL_CLASSES
+#ifndef FRAME_POOL_GRAIN
+#define FRAME_POOL_GRAIN (64)
+#endif
+#ifndef FRAME_POOL_CLASSES
+#define FRAME_POOL_CLASSES (16)
+#endif
+
+namespace c_utils {
+
+namespace detail {
+// Released frames are kept on a per thread free list of their size class and handed back to the next
+// coroutine of the same class, so spawning in steady state doesn't reach the heap. Larger frames use new.
+struct FramePool {
+  struct Block {
+    Block *next;
+  };
+  Block *free[FRAME_POOL_CLASSES] = {};
+
+  ~FramePool() {
+    for (Block *&head : free) {
+      while (nullptr != head) {
+        Block *block = head;
+        head         = block->next;
+        ::operator delete(block);
+      }
+    }
+  }
+  static std::size_t size_class(std::size_t size) {
+    return (size + FRAME_POOL_GRAIN - 1) / FRAME_POOL_GRAIN - 1;
+  }
+  static FramePool &local() {
+    static thread_local FramePool pool;
+    return pool;
+  }
+};
+
+inline void *frame_alloc(std::size_t size) {
+  std::size_t const idx = FramePool::size_class(size);
+  if (FRAME_POOL_CLASSES <= idx) return ::operator new(size);
+
+  FramePool::Block *&head = FramePool::local().free[idx];
+  if (nullptr == head) return ::operator new((idx + 1) * FRAME_POOL_GRAIN);
+  FramePool::Block *block = head;
+  head                    = block->next;
+  return block;
+}
+
+inline void frame_free(void *frame, std::size_t size) {
+  std::size_t const idx = FramePool::size_class(size);
+  if (FRAME_POOL_CLASSES <= idx) {
+    ::operator delete(frame);
+    return;
+  }
+  FramePool::Block *&head = FramePool::local().free[idx];
+  FramePool::Block  *block = static_cast<FramePool::Block *>(frame);
+  block->next              = head;
+  head                     = block;
+}
+
+// FIFO of suspended awaiters linked through their own storage (in the coroutine frames)
+template <class Node> struct WaitList {
+  Node *head = nullptr;
+  Node *tail = nullptr;
+
+  void push(Node *node) {
+    node->next = nullptr;
+    if (nullptr == tail) {
+      head = node;
+    } else {
+      tail->next = node;
+    }
+    tail = node;
+  }
+  Node *pop() {
+    Node *node = head;
+    if (nullptr != node) {
+      head = node->next;
+      if (nullptr == head) tail = nullptr;
+    }
+    return node;
+  }
+};
+} // namespace detail
+
+// Fire and forget coroutine: starts when spawned on a Scheduler and frees its frame when it returns.
+class Task {
+public:
+  struct promise_type {
+    Task get_return_object() {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept {
+      return {};
+    }
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+    void return_void() {}
+    void unhandled_exception() {
+      std::terminate();
+    }
+    static void *operator new(std::size_t size) {
+      return detail::frame_alloc(size);
+    }
+    static void operator delete(void *frame, std::size_t size) {
+      detail::frame_free(frame, size);
+    }
+  };
+
+  Task(Task &&other) : _handle(std::exchange(other._handle, nullptr)) {}
+  Task(Task const &)            = delete;
+  Task &operator=(Task const &) = delete;
+  Task &operator=(Task &&)      = delete;
+  // A task never spawned is destroyed without running
+  ~Task() {
+    if (_handle) _handle.destroy();
+  }
+
+  std::coroutine_handle<> release() {
+    return std::exchange(_handle, nullptr);
+  }
+
+private:
+  explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+
+  std::coroutine_handle<promise_type> _handle;
+};
+
+// Single threaded run queue of ready coroutines. With an eventfd the descriptor becomes readable when the
+// ready queue stops being empty, so the scheduler can sit in an epoll loop next to other descriptors:
+//   epoll_wait(...) -> scheduler.run();
+class Scheduler {
+public:
+  explicit Scheduler(bool use_eventfd = false) {
+#if defined(__linux__)
+    if (use_eventfd) _event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
+    (void)use_eventfd;
+#endif
+  }
+  Scheduler(Scheduler const &)            = delete;
+  Scheduler &operator=(Scheduler const &) = delete;
+  ~Scheduler() {
+#if defined(__linux__)
+    if (0 <= _event_fd) close(_event_fd);
+#endif
+  }
+
+  // Descriptor to poll for readiness, -1 when not requested (or not supported)
+  int event_fd() const {
+    return _event_fd;
+  }
+  bool idle() const {
+    return _ready.empty();
+  }
+
+  void spawn(Task task) {
+    schedule(task.release());
+  }
+  void schedule(std::coroutine_handle<> handle) {
+    bool const was_idle = _ready.empty();
+    if (!_ready.enqueue(handle)) {
+      handle.resume();
+      return;
+    }
+#if defined(__linux__)
+    if (was_idle && (0 <= _event_fd)) {
+      uint64_t const one = 1;
+      (void)!write(_event_fd, &one, sizeof(one));
+    }
+#else
+    (void)was_idle;
+#endif
+  }
+
+  // Resumes the ready coroutines (and the ones they make ready) until none is left, returns how many ran
+  std::size_t run() {
+    std::size_t resumed = 0;
+#if defined(__linux__)
+    if (0 <= _event_fd) {
+      uint64_t count = 0;
+      (void)!read(_event_fd, &count, sizeof(count));
+    }
+#endif
+    while (!_ready.empty()) {
+      _ready.front().resume();
+      ++resumed;
+    }
+    return resumed;
+  }
+
+private:
+  Queue<std::coroutine_handle<>, SCHEDULER_READY_SLOTS> _ready;
+  int                                                   _event_fd = -1;
+};
+
+// Bounded channel between coroutines of the same Scheduler, buffered on a Queue of max_size elements.
+//   co_await channel.enqueue(value)  suspends while the channel is full, false once closed
+//   co_await channel.dequeue()       suspends while the channel is empty, std::nullopt once closed and empty
+// The suspended awaiters wait in intrusive lists inside their own coroutine frames and the values are handed
+// over directly to a waiting consumer, so suspend/resume doesn't allocate.
+template <class T, uint16_t max_size> class AsyncChannel {
+public:
+  class EnqueueAwaiter {
+  public:
+    bool await_ready() {
+      return _channel->try_enqueue(*this);
+    }
+    void await_suspend(std::coroutine_handle<> handle) {
+      _handle = handle;
+      _channel->_producers.push(this);
+    }
+    bool await_resume() const {
+      return _is_ok;
+    }
+
+  private:
+    friend class AsyncChannel;
+    friend struct detail::WaitList<EnqueueAwaiter>;
+
+    EnqueueAwaiter(AsyncChannel *channel, T &&value) : _channel(channel), _value(std::move(value)) {}
+
+    AsyncChannel           *_channel;
+    T                       _value;
+    std::coroutine_handle<> _handle;
+    EnqueueAwaiter         *next   = nullptr; // wait list link
+    bool                    _is_ok = false;
+  };
+
+  class DequeueAwaiter {
+  public:
+    bool await_ready() {
+      return _channel->try_dequeue(*this);
+    }
+    void await_suspend(std::coroutine_handle<> handle) {
+      _handle = handle;
+      _channel->_consumers.push(this);
+    }
+    std::optional<T> await_resume() {
+      return std::move(_value);
+    }
+
+  private:
+    friend class AsyncChannel;
+    friend struct detail::WaitList<DequeueAwaiter>;
+
+    explicit DequeueAwaiter(AsyncChannel *channel) : _channel(channel) {}
+
+    AsyncChannel           *_channel;
+    std::optional<T>        _value;
+    std::coroutine_handle<> _handle;
+    DequeueAwaiter         *next = nullptr; // wait list link
+  };
+
+  explicit AsyncChannel(Scheduler &scheduler) : _scheduler(scheduler) {}
+  AsyncChannel(AsyncChannel const &)            = delete;
+  AsyncChannel &operator=(AsyncChannel const &) = delete;
+
+  EnqueueAwaiter enqueue(T value) {
+    return EnqueueAwaiter(this, std::move(value));
+  }
+  DequeueAwaiter dequeue() {
+    return DequeueAwaiter(this);
+  }
+
+  // Wakes every suspended producer (false) and consumer (std::nullopt once the buffer is drained)
+  void close() {
+    _closed = true;
+    while (EnqueueAwaiter *producer = _producers.pop()) _scheduler.schedule(producer->_handle);
+    while (DequeueAwaiter *consumer = _consumers.pop()) _scheduler.schedule(consumer->_handle);
+  }
+  bool closed() const {
+    return _closed;
+  }
+  uint16_t size() const {
+    return _buff.size();
+  }
+
+private:
+  Scheduler                       &_scheduler;
+  Queue<T, max_size>               _buff;
+  detail::WaitList<EnqueueAwaiter> _producers;
+  detail::WaitList<DequeueAwaiter> _consumers;
+  bool                             _closed = false;
+
+  bool try_enqueue(EnqueueAwaiter &producer) {
+    if (_closed) return true;
+
+    if (DequeueAwaiter *consumer = _consumers.pop()) {
+      consumer->_value.emplace(std::move(producer._value));
+      _scheduler.schedule(consumer->_handle);
+      producer._is_ok = true;
+    } else {
+      producer._is_ok = _buff.enqueue(std::move(producer._value));
+    }
+    return producer._is_ok;
+  }
+
+  bool try_dequeue(DequeueAwaiter &consumer) {
+    if (_buff.empty()) return _closed;
+
+    consumer._value.emplace(_buff.front());
+    // A slot just got free, the oldest suspended producer fills it
+    if (EnqueueAwaiter *producer = _producers.pop()) {
+      producer->_is_ok = _buff.enqueue(std::move(producer->_value));
+      _scheduler.schedule(producer->_handle);
+    }
+    return true;
+  }
+};
+
+} // namespace c_utils
+
+#endif /* ASYNC_CHANNEL_HPP_ */
@@ -0,0 +1,273 @@
+/**
+ * @file dynamic_queue.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define a Queue (FIFO) with runtime capacity and allocator, and a huge page allocator
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef DYNAMIC_QUEUE_HPP_
+#define DYNAMIC_QUEUE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Size of the huge pages requested by HugePageAllocator (x86-64 and ARM64 default)
+#ifndef HUGE_PAGE_SIZE
+#define HUGE_PAGE_SIZE (2UL * 1024UL * 1024UL)
+#endif
+
+namespace c_utils {
+
+// Same behavior as Queue but the slots live in memory from Alloc and the capacity is chosen at runtime,
+// rounded up to a power of 2 so the free-running indices wrap with a mask instead of a branch or a modulo.
+// A moved-from queue has no slots (capacity 0): enqueue fails and emplace/push allocate a single slot.
+//   c_utils::DynamicQueue<Sample, c_utils::HugePageAllocator<Sample>> samples(cfg.depth);
+template <class T, class Alloc = std::allocator<T>> class DynamicQueue {
+  using Traits = std::allocator_traits<Alloc>;
+
+public:
+  using allocator_type = Alloc;
+
+  explicit DynamicQueue(std::size_t capacity, Alloc const &alloc = Alloc())
+      : _alloc(alloc), _mask(round_up_pow2(capacity) - 1) {
+    _buff = Traits::allocate(_alloc, _mask + 1);
+  }
+  DynamicQueue(DynamicQueue const &)            = delete;
+  DynamicQueue &operator=(DynamicQueue const &) = delete;
+  DynamicQueue(DynamicQueue &&other)
+      : _alloc(std::move(other._alloc)), _buff(std::exchange(other._buff, nullptr)),
+        _mask(std::exchange(other._mask, 0)), _head(std::exchange(other._head, 0)),
+        _tail(std::exchange(other._tail, 0)) {}
+  DynamicQueue &operator=(DynamicQueue &&other) {
+    if (this != &other) {
+      release();
+      if constexpr (Traits::propagate_on_container_move_assignment::value) _alloc = std::move(other._alloc);
+
+      if (Traits::propagate_on_container_move_assignment::value || (_alloc == other._alloc)) {
+        _buff = std::exchange(other._buff, nullptr);
+        _mask = std::exchange(other._mask, 0);
+        _head = std::exchange(other._head, 0);
+        _tail = std::exchange(other._tail, 0);
+      } else if (nullptr != other._buff) {
+        // The other buffer can't be freed with this allocator, the elements are moved one by one
+        _mask = other._mask;
+        _buff = Traits::allocate(_alloc, _mask + 1);
+        while (!other.empty()) {
+          insert_head(std::move(other._buff[other._tail & other._mask]));
+          other.remove_tail();
+        }
+        other.release();
+      }
+    }
+    return *this;
+  }
+  ~DynamicQueue() {
+    release();
+  }
+
+  bool empty() const {
+    return (_head == _tail);
+  }
+  std::size_t size() const {
+    return (_head - _tail);
+  }
+  std::size_t capacity() const {
+    return (nullptr != _buff) ? (_mask + 1) : 0;
+  }
+  allocator_type get_allocator() const {
+    return _alloc;
+  }
+
+  // Destroys all the elements
+  void clear() {
+    while (!empty()) remove_tail();
+  }
+
+  // Constructs a new(est) element in place, if the queue is full the next (oldest) element is dropped.
+  template <class... Args> T &emplace(Args &&...args) {
+    if (nullptr == _buff) _buff = Traits::allocate(_alloc, _mask + 1); // Moved-from, _mask is 0
+    if (size() <= _mask) return insert_head(std::forward<Args>(args)...);
+    // The args can refer to the element dropped (e.g. push(oldest)), it's built before the drop
+    T elem(std::forward<Args>(args)...);
+    remove_tail();
+    return insert_head(std::move(elem));
+  }
+  void push(T const &val) {
+    emplace(val);
+  }
+  void push(T &&val) {
+    emplace(std::move(val));
+  }
+
+  // removes next (oldest) element, reduces the container size by one.
+  bool pop() {
+    bool is_ok = false;
+    if (!empty()) {
+      remove_tail();
+      is_ok = true;
+    }
+    return is_ok;
+  }
+
+  // Inserts a new(est) element after its current last element if the queue is not full.
+  bool enqueue(T const &val) {
+    bool is_ok = false;
+    if ((nullptr != _buff) && (size() <= _mask)) {
+      insert_head(val);
+      is_ok = true;
+    }
+    return is_ok;
+  }
+  bool enqueue(T &&val) {
+    bool is_ok = false;
+    if ((nullptr != _buff) && (size() <= _mask)) {
+      insert_head(std::move(val));
+      is_ok = true;
+    }
+    return is_ok;
+  }
+
+  // Provides (moved) the next (oldest) element in the queue, reduces the container by one
+  bool dequeue(T &element) {
+    bool is_ok = false;
+    if (!empty()) {
+      element = std::move(_buff[_tail & _mask]);
+      remove_tail();
+      is_ok = true;
+    }
+    return is_ok;
+  }
+
+private:
+  Alloc       _alloc;
+  T          *_buff = nullptr;
+  std::size_t _mask = 0;
+  std::size_t _head = 0; // free-running, the slot is _head & _mask
+  std::size_t _tail = 0;
+
+  static std::size_t round_up_pow2(std::size_t capacity) {
+    std::size_t pow2 = 1;
+    while (pow2 < capacity) pow2 <<= 1;
+    return pow2;
+  }
+
+  void remove_tail() {
+    Traits::destroy(_alloc, &_buff[_tail & _mask]);
+    ++_tail;
+  }
+  template <class... Args> T &insert_head(Args &&...args) {
+    T *elem = &_buff[_head & _mask];
+    Traits::construct(_alloc, elem, std::forward<Args>(args)...);
+    ++_head;
+    return *elem;
+  }
+  void release() {
+    if (nullptr != _buff) {
+      clear();
+      Traits::deallocate(_alloc, _buff, _mask + 1);
+      _buff = nullptr;
+      _mask = 0;
+      _head = 0;
+      _tail = 0;
+    }
+  }
+};
+
+#if defined(__linux__)
+// Stateless allocator mapping memory straight from the kernel. Requests of at least HUGE_PAGE_SIZE are
+// rounded up to whole huge pages and mapped with MAP_HUGETLB (reserved hugetlbfs pages); when none are
+// available it falls back to a regular mapping aligned to HUGE_PAGE_SIZE with madvise(MADV_HUGEPAGE) so
+// transparent huge pages can back it. Smaller requests are whole regular pages. Fewer TLB misses on
+// multi-megabyte queues, meant for few large long-lived allocations.
+template <class T> class HugePageAllocator {
+public:
+  using value_type = T;
+
+  HugePageAllocator() = default;
+  template <class U> HugePageAllocator(HugePageAllocator<U> const &) {}
+
+  T *allocate(std::size_t count) {
+    std::size_t const length = map_length(count);
+    void             *mem    = MAP_FAILED;
+
+    if (HUGE_PAGE_SIZE <= length) {
+      mem = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (MAP_FAILED == mem) mem = map_aligned(length);
+    } else {
+      mem = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    if (MAP_FAILED == mem) throw std::bad_alloc();
+    return static_cast<T *>(mem);
+  }
+  void deallocate(T *ptr, std::size_t count) {
+    munmap(ptr, map_length(count));
+  }
+
+  friend bool operator==(HugePageAllocator const &, HugePageAllocator const &) {
+    return true;
+  }
+  friend bool operator!=(HugePageAllocator const &, HugePageAllocator const &) {
+    return false;
+  }
+
+  // Bytes mapped for count elements
+  static std::size_t map_length(std::size_t count) {
+    std::size_t const bytes = count * sizeof(T);
+    std::size_t       page  = static_cast<std::size_t>(getpagesize());
+    if (HUGE_PAGE_SIZE <= bytes) page = HUGE_PAGE_SIZE;
+    return (bytes + page - 1) / page * page;
+  }
+
+private:
+  // Maps one huge page more than needed and trims both ends so the region starts on a huge page boundary
+  static void *map_aligned(std::size_t length) {
+    int const   flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    void *const mem   = mmap(nullptr, length + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (MAP_FAILED == mem) return mem;
+
+    uintptr_t const raw     = reinterpret_cast<uintptr_t>(mem);
+    uintptr_t const aligned = (raw + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+    uintptr_t const tail    = raw + HUGE_PAGE_SIZE - aligned; // unused bytes after the region
+    if (aligned > raw) munmap(mem, aligned - raw);
+    if (0 < tail) munmap(reinterpret_cast<void *>(aligned + length), tail);
+    madvise(reinterpret_cast<void *>(aligned), length, MADV_HUGEPAGE);
+    return reinterpret_cast<void *>(aligned);
+  }
+};
+#endif
+
+} // namespace c_utils
+
+#endif /* DYNAMIC_QUEUE_HPP_ */
@@ -0,0 +1,205 @@
+/**
+ * @file mpmc_queue.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define a lock-free Multiple Producer Multiple Consumer Queue (FIFO)
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef MPMC_QUEUE_HPP_
+#define MPMC_QUEUE_HPP_
+
+#include "queue/queue_defines.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <utility>
+
+// Attempts of the blocking variants before going to sleep
+#ifndef MPMC_QUEUE_SPINS
+#define MPMC_QUEUE_SPINS (16)
+#endif
+
+namespace c_utils {
+
+// Bounded FIFO shared by any number of producer and consumer threads. Every slot carries a sequence number:
+// seq == pos means free for the producer claiming pos, seq == pos + 1 means ready for the consumer claiming
+// pos. An operation claims its position with a single CAS on head/tail and publishes the slot by storing the
+// next sequence (release), so producers and consumers only contend among themselves on separate lines.
+// The wait_* variants block on a 32-bit epoch word (atomic::wait or futex), woken only when there are
+// sleepers so the non blocking path pays a fence and a load.
+template <class T, std::size_t max_size> class MpmcQueue {
+  static_assert(max_size > 0, "A queue needs at least 1 slot");
+  static_assert(std::atomic<std::size_t>::is_always_lock_free, "Lock-free sequences required");
+
+private:
+  struct Slot {
+    std::atomic<std::size_t> seq;
+    alignas(T) unsigned char data[sizeof(T)];
+  };
+
+  // Epoch words bumped on each side when a sleeper may be waiting for it and the number of sleepers
+  struct Waiters {
+    std::atomic<uint32_t> epoch{ 0 };
+    std::atomic<uint32_t> count{ 0 };
+  };
+
+  alignas(cache_line_size) std::atomic<std::size_t> _head{ 0 };
+  alignas(cache_line_size) std::atomic<std::size_t> _tail{ 0 };
+  alignas(cache_line_size) Waiters _pushed; // consumers waiting for an element
+  alignas(cache_line_size) Waiters _popped; // producers waiting for a free slot
+  alignas(cache_line_size) Slot _buff[max_size];
+
+  T *data(Slot &slot) {
+    return std::launder(reinterpret_cast<T *>(slot.data));
+  }
+
+  static void wake(Waiters &waiters) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (0 < waiters.count.load(std::memory_order_relaxed)) {
+      waiters.epoch.fetch_add(1, std::memory_order_release);
+      detail::atomic_notify_all(waiters.epoch);
+    }
+  }
+
+  // Retries the operation until it succeeds, yielding for a few attempts and then sleeping on the waiters
+  // epoch between attempts
+  template <class Try> static void wait_for(Waiters &waiters, Try try_op) {
+    for (int spin = 0; spin < MPMC_QUEUE_SPINS; ++spin) {
+      if (try_op()) return;
+      std::this_thread::yield();
+    }
+    while (!try_op()) {
+      waiters.count.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      uint32_t const epoch = waiters.epoch.load(std::memory_order_acquire);
+      bool const     done  = try_op();
+      if (!done) detail::atomic_wait(waiters.epoch, epoch);
+      waiters.count.fetch_sub(1, std::memory_order_relaxed);
+      if (done) break;
+    }
+  }
+
+public:
+  explicit MpmcQueue() {
+    for (std::size_t i = 0; i < max_size; ++i) _buff[i].seq.store(i, std::memory_order_relaxed);
+  }
+  MpmcQueue(MpmcQueue const &)            = delete;
+  MpmcQueue &operator=(MpmcQueue const &) = delete;
+  ~MpmcQueue() {
+    std::size_t const head = _head.load(std::memory_order_relaxed);
+    for (std::size_t i = _tail.load(std::memory_order_relaxed); i != head; ++i) {
+      data(_buff[i % max_size])->~T();
+    }
+  }
+
+  // Approximate when called while other threads are running
+  bool empty() const {
+    return (0 == size());
+  }
+  std::size_t size() const {
+    std::size_t const tail = _tail.load(std::memory_order_acquire);
+    std::size_t const head = _head.load(std::memory_order_acquire);
+    return (head > tail) ? (head - tail) : 0;
+  }
+  static constexpr std::size_t capacity() {
+    return max_size;
+  }
+
+  // Constructs a new(est) element in place if the queue is not full.
+  template <class... Args> bool try_emplace(Args &&...args) {
+    std::size_t pos  = _head.load(std::memory_order_relaxed);
+    Slot       *slot = nullptr;
+    for (;;) {
+      slot                    = &_buff[pos % max_size];
+      std::size_t const   seq = slot->seq.load(std::memory_order_acquire);
+      std::intptr_t const dif = static_cast<std::intptr_t>(seq - pos);
+      if (0 == dif) {
+        if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (0 > dif) {
+        return false; // The slot still holds the element of the previous lap
+      } else {
+        pos = _head.load(std::memory_order_relaxed);
+      }
+    }
+    ::new (static_cast<void *>(slot->data)) T(std::forward<Args>(args)...);
+    slot->seq.store(pos + 1, std::memory_order_release);
+    wake(_pushed);
+    return true;
+  }
+  bool try_enqueue(T const &val) {
+    return try_emplace(val);
+  }
+  bool try_enqueue(T &&val) {
+    return try_emplace(std::move(val));
+  }
+
+  // Provides (moved) the next (oldest) element in the queue if it's not empty.
+  bool try_dequeue(T &element) {
+    std::size_t pos  = _tail.load(std::memory_order_relaxed);
+    Slot       *slot = nullptr;
+    for (;;) {
+      slot                    = &_buff[pos % max_size];
+      std::size_t const   seq = slot->seq.load(std::memory_order_acquire);
+      std::intptr_t const dif = static_cast<std::intptr_t>(seq - (pos + 1));
+      if (0 == dif) {
+        if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (0 > dif) {
+        return false; // The slot is not published yet
+      } else {
+        pos = _tail.load(std::memory_order_relaxed);
+      }
+    }
+    T *elem = data(*slot);
+    element = std::move(*elem);
+    elem->~T();
+    slot->seq.store(pos + max_size, std::memory_order_release);
+    wake(_popped);
+    return true;
+  }
+
+  // Blocking variants, wait while the queue is full (producers) or empty (consumers)
+  template <class... Args> void wait_emplace(Args &&...args) {
+    // The arguments are only forwarded by the attempt that succeeds
+    wait_for(_popped, [&]() { return try_emplace(std::forward<Args>(args)...); });
+  }
+  void wait_enqueue(T const &val) {
+    wait_emplace(val);
+  }
+  void wait_enqueue(T &&val) {
+    wait_emplace(std::move(val));
+  }
+  void wait_dequeue(T &element) {
+    wait_for(_pushed, [&]() { return try_dequeue(element); });
+  }
+};
+
+} // namespace c_utils
+
+#endif /* MPMC_QUEUE_HPP_ */
@@ -30,85 +30,374 @@
  *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
  ******************************************************************************/
 
+#ifndef QUEUE_HPP_
+#define QUEUE_HPP_
+
+#include <algorithm>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
 
 namespace c_utils {
 
+// Bounded FIFO on raw slots: the elements are constructed in place when inserted and destroyed when removed,
+// so T doesn't need to be default constructible and move-only types are supported.
 template <class T, uint16_t max_size> class Queue {
+  static_assert(max_size > 0, "A queue needs at least 1 slot");
+
 private:
-  T        _buff[max_size];
+  alignas(T) unsigned char _buff[max_size][sizeof(T)];
   bool     _full = false;
   uint16_t _head = 0;
   uint16_t _tail = 0;
 
+  T *slot(uint16_t idx) {
+    return std::launder(reinterpret_cast<T *>(_buff[idx]));
+  }
+  T const *slot(uint16_t idx) const {
+    return std::launder(reinterpret_cast<T const *>(_buff[idx]));
+  }
+  static uint16_t next(uint16_t idx) {
+    return (idx + 1U == max_size) ? 0U : static_cast<uint16_t>(idx + 1U);
+  }
+
+  static uint16_t advance(uint16_t idx, uint16_t count) {
+    uint32_t const pos = static_cast<uint32_t>(idx) + count;
+    return static_cast<uint16_t>((pos >= max_size) ? pos - max_size : pos);
+  }
+
+  // Copies count elements into the free slots from idx on, without wrapping
+  void copy_in(uint16_t idx, T const *src, uint16_t count) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+      if (0 < count) std::memcpy(_buff[idx], src, count * sizeof(T));
+    } else {
+      std::uninitialized_copy(src, src + count, slot(idx));
+    }
+  }
+  // Moves count elements out of the slots from idx on and destroys them, without wrapping
+  void move_out(uint16_t idx, T *dst, uint16_t count) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+      if (0 < count) std::memcpy(dst, _buff[idx], count * sizeof(T));
+    } else {
+      T *first = slot(idx);
+      std::move(first, first + count, dst);
+      std::destroy(first, first + count);
+    }
+  }
+
+  // Destroys the next (oldest) element, the queue can't be empty
+  void remove_tail() {
+    slot(_tail)->~T();
+    _tail = next(_tail);
+    _full = false;
+  }
+
+  // Constructs a new element on the head, the queue can't be full
+  template <class... Args> T &insert_head(Args &&...args) {
+    T *elem = ::new (static_cast<void *>(_buff[_head])) T(std::forward<Args>(args)...);
+    _head   = next(_head);
+    if (_tail == _head) _full = true;
+    return *elem;
+  }
+
+  template <class Q> void insert_from(Q &&other) {
+    for (uint16_t i = other._tail, n = other.size(); n > 0; i = next(i), --n) {
+      if constexpr (std::is_lvalue_reference<Q>::value) {
+        insert_head(*other.slot(i));
+      } else {
+        insert_head(std::move(*other.slot(i)));
+      }
+    }
+  }
+
 public:
+  // Read-only random access over the elements from the next (oldest) to the newest. The elements are stored
+  // in two contiguous runs (from the tail to the end of the buffer, then from its start), the iterator keeps
+  // both so the wrap is a compare on the position instead of a modulo per element.
+  class const_iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T const *;
+    using reference         = T const &;
+
+    const_iterator() = default;
+
+    reference operator*() const {
+      return (_pos < _split) ? _run_a[_pos] : _run_b[_pos - _split];
+    }
+    pointer operator->() const {
+      return &**this;
+    }
+    reference operator[](difference_type n) const {
+      return *(*this + n);
+    }
+
+    const_iterator &operator++() {
+      ++_pos;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator prev = *this;
+      ++_pos;
+      return prev;
+    }
+    const_iterator &operator--() {
+      --_pos;
+      return *this;
+    }
+    const_iterator operator--(int) {
+      const_iterator prev = *this;
+      --_pos;
+      return prev;
+    }
+    const_iterator &operator+=(difference_type n) {
+      _pos += n;
+      return *this;
+    }
+    const_iterator &operator-=(difference_type n) {
+      _pos -= n;
+      return *this;
+    }
+    friend const_iterator operator+(const_iterator it, difference_type n) {
+      return it += n;
+    }
+    friend const_iterator operator+(difference_type n, const_iterator it) {
+      return it += n;
+    }
+    friend const_iterator operator-(const_iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const_iterator const &lhs, const_iterator const &rhs) {
+      return lhs._pos - rhs._pos;
+    }
+
+    friend bool operator==(const_iterator const &lhs, const_iterator const &rhs) {
+      return lhs._pos == rhs._pos;
+    }
+    friend bool operator!=(const_iterator const &lhs, const_iterator const &rhs) {
+      return lhs._pos != rhs._pos;
+    }
+    friend bool operator<(const_iterator const &lhs, const_iterator const &rhs) {
+      return lhs._pos < rhs._pos;
+    }
+    friend bool operator>(const_iterator const &lhs, const_iterator const &rhs) {
+      return lhs._pos > rhs._pos;
+    }
+    friend bool operator<=(const_iterator const &lhs, const_iterator const &rhs) {
+      return lhs._pos <= rhs._pos;
+    }
+    friend bool operator>=(const_iterator const &lhs, const_iterator const &rhs) {
+      return lhs._pos >= rhs._pos;
+    }
+
+  private:
+    friend class Queue;
+
+    const_iterator(T const *run_a, T const *run_b, difference_type split, difference_type pos)
+        : _run_a(run_a), _run_b(run_b), _split(split), _pos(pos) {}
+
+    T const        *_run_a = nullptr; // from the tail to the end of the buffer
+    T const        *_run_b = nullptr; // from the start of the buffer
+    difference_type _split = 0;       // elements in the first run
+    difference_type _pos   = 0;       // relative to the tail
+  };
+
   explicit Queue() = default;
-  ~Queue() {}
+  Queue(Queue const &other) {
+    insert_from(other);
+  }
+  Queue(Queue &&other) {
+    insert_from(std::move(other));
+    other.clear();
+  }
+  Queue &operator=(Queue const &other) {
+    if (this != &other) {
+      clear();
+      insert_from(other);
+    }
+    return *this;
+  }
+  Queue &operator=(Queue &&other) {
+    if (this != &other) {
+      clear();
+      insert_from(std::move(other));
+      other.clear();
+    }
+    return *this;
+  }
+  ~Queue() {
+    clear();
+  }
 
   bool empty() const {
     return ((_tail == _head) && !_full);
   }
   // return the size of the current elements
   uint16_t size() const {
-    uint16_t size = 0;
-    if (!empty()) {
-      size = (0 > _head - _tail) ? max_size + (_head - _tail) : _head - _tail;
+    uint16_t size = max_size;
+    if (!_full) {
+      size = (_head >= _tail) ? (_head - _tail) : (max_size - (_tail - _head));
     }
     return size;
   }
 
+  // Element at position idx from the next (oldest) element, idx shall be less than size()
+  T const &operator[](uint16_t idx) const {
+    return *slot(advance(_tail, idx));
+  }
+  T &operator[](uint16_t idx) {
+    return *slot(advance(_tail, idx));
+  }
+
+  const_iterator begin() const {
+    return const_iterator(slot(_tail), slot(0), max_size - _tail, 0);
+  }
+  const_iterator end() const {
+    return const_iterator(slot(_tail), slot(0), max_size - _tail, size());
+  }
+  const_iterator cbegin() const {
+    return begin();
+  }
+  const_iterator cend() const {
+    return end();
+  }
+
+  // Destroys all the elements
+  void clear() {
+    while (!empty()) remove_tail();
+  }
+
+  // Constructs a new(est) element in place after its current last element, increases the container size by
+  // one. If the queue is full the next (oldest) element is dropped.
+  template <class... Args> T &emplace(Args &&...args) {
+    if (!_full) return insert_head(std::forward<Args>(args)...);
+    // The args can refer to the element dropped (e.g. push(q[0])), it's built before the drop
+    T elem(std::forward<Args>(args)...);
+    remove_tail();
+    return insert_head(std::move(elem));
+  }
+
   // Inserts a new(est) element after its current last element, increases the container size by one.
-  void push(T val) {
-    _buff[_head] = val;
-    _head        = (++_head) == max_size ? 0 : _head;
-    if (_full) _tail = (++_tail) == max_size ? 0 : _tail;
-    if (_tail == _head) _full = true;
+  void push(T const &val) {
+    emplace(val);
+  }
+  void push(T &&val) {
+    emplace(std::move(val));
   }
 
   // removes next (oldest) element, reduces the container size by one.
   bool pop() {
     bool is_ok = false;
     if (!empty()) {
-      _tail = (++_tail) == max_size ? 0 : _tail;
+      remove_tail();
       is_ok = true;
     }
     return is_ok;
   }
 
-  // Inserts a new(est) element after its current last element, increases the container size by one.
-  bool enqueue(T val) {
+  // Inserts a new(est) element after its current last element if the queue is not full.
+  bool enqueue(T const &val) {
     bool is_ok = false;
     if (!_full) {
-      _buff[_head] = val;
-      _head        = (++_head) == max_size ? 0 : _head;
-
-      if (_tail == _head) _full = true;
+      insert_head(val);
+      is_ok = true;
+    }
+    return is_ok;
+  }
+  bool enqueue(T &&val) {
+    bool is_ok = false;
+    if (!_full) {
+      insert_head(std::move(val));
       is_ok = true;
     }
     return is_ok;
   }
 
-  // Provides as a reference on the in/out element arg the next (oldest) element in the queue,
+  // Provides (moved) as a reference on the in/out element arg the next (oldest) element in the queue,
   // reduces the container by one
   bool dequeue(T &element) {
     bool is_ok = false;
     if (!empty()) {
-      element = _buff[_tail];
-      _tail   = (++_tail) == max_size ? 0 : _tail;
-      _full   = false;
-      is_ok   = true;
+      element = std::move(*slot(_tail));
+      remove_tail();
+      is_ok = true;
     }
     return is_ok;
   }
-  // Returns a reference to the next (oldest) element in the queue.
+  // Inserts (copied) up to count elements after its current last element, as many as free slots. The run is
+  // written in at most two contiguous chunks (memcpy for trivially copyable T). Returns the inserted count.
+  uint16_t enqueue_bulk(T const *elements, uint16_t count) {
+    uint16_t const n     = std::min<uint16_t>(count, max_size - size());
+    uint16_t const first = std::min<uint16_t>(n, max_size - _head);
+
+    copy_in(_head, elements, first);
+    copy_in(0, elements + first, n - first);
+    _head = advance(_head, n);
+    if ((0 < n) && (_tail == _head)) _full = true;
+    return n;
+  }
+
+  // Provides (moved) up to count of the next (oldest) elements in the out array, in at most two contiguous
+  // chunks (memcpy for trivially copyable T). Returns the provided count.
+  uint16_t dequeue_bulk(T *elements, uint16_t count) {
+    uint16_t const n     = std::min<uint16_t>(count, size());
+    uint16_t const first = std::min<uint16_t>(n, max_size - _tail);
+
+    move_out(_tail, elements, first);
+    move_out(0, elements + first, n - first);
+    _tail = advance(_tail, n);
+    if (0 < n) _full = false;
+    return n;
+  }
+
+#if __cplusplus >= 202002L
+  uint16_t enqueue_bulk(std::span<T const> elements) {
+    std::size_t const count = std::min<std::size_t>(elements.size(), max_size);
+    return enqueue_bulk(elements.data(), static_cast<uint16_t>(count));
+  }
+  uint16_t dequeue_bulk(std::span<T> elements) {
+    std::size_t const count = std::min<std::size_t>(elements.size(), max_size);
+    return dequeue_bulk(elements.data(), static_cast<uint16_t>(count));
+  }
+#endif
+
+  // Calls fn(element) from the next (oldest) to the newest element, walking the two contiguous runs, then
+  // destroys all of them. Returns the drained count.
+  template <class F> uint16_t drain(F &&fn) {
+    uint16_t const n     = size();
+    uint16_t const first = std::min<uint16_t>(n, max_size - _tail);
+    T *const       run_a = slot(_tail);
+    T *const       run_b = slot(0);
+
+    for (T *elem = run_a; elem != run_a + first; ++elem) fn(*elem);
+    for (T *elem = run_b; elem != run_b + (n - first); ++elem) fn(*elem);
+    std::destroy(run_a, run_a + first);
+    std::destroy(run_b, run_b + (n - first));
+    _tail = _head;
+    _full = false;
+    return n;
+  }
+
+  // Returns (moved) the next (oldest) element in the queue, reduces the container by one.
   T front() {
     if (empty()) return T();
 
-    T element = _buff[_tail];
-    _tail     = (++_tail) == max_size ? 0 : _tail;
-    _full     = false;
+    T element = std::move(*slot(_tail));
+    remove_tail();
 
     return element;
   }
 };
-} // namespace c_utils
\ No newline at end of file
+} // namespace c_utils
+
+#endif /* QUEUE_HPP_ */
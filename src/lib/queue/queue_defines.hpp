@@ -0,0 +1,87 @@
+/**
+ * @file queue_defines.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define the common settings of the concurrent queues
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef QUEUE_DEFINES_HPP_
+#define QUEUE_DEFINES_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#if !defined(__cpp_lib_atomic_wait) && defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace c_utils {
+
+// Minimum offset between two objects to avoid false sharing. GCC warns on any use of
+// std::hardware_destructive_interference_size (its value follows -mtune, so it's not ABI stable), hence the
+// usual x86/ARM line size there.
+#if defined(__cpp_lib_hardware_interference_size) && !defined(__GNUC__)
+constexpr std::size_t cache_line_size = std::hardware_destructive_interference_size;
+#else
+constexpr std::size_t cache_line_size = 64;
+#endif
+
+namespace detail {
+// Blocks while the word holds old, C++20 atomic::wait or a futex on C++17 (Linux), spinning otherwise
+inline void atomic_wait(std::atomic<uint32_t> &word, uint32_t old) {
+#if defined(__cpp_lib_atomic_wait)
+  word.wait(old, std::memory_order_acquire);
+#elif defined(__linux__)
+  static_assert(sizeof(word) == sizeof(uint32_t), "futex word shall be 32 bits");
+  while (word.load(std::memory_order_acquire) == old) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE, old, nullptr, nullptr, 0);
+  }
+#else
+  while (word.load(std::memory_order_acquire) == old) std::this_thread::yield();
+#endif
+}
+// Wakes all the threads blocked on the word
+inline void atomic_notify_all(std::atomic<uint32_t> &word) {
+#if defined(__cpp_lib_atomic_wait)
+  word.notify_all();
+#elif defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+  (void)word;
+#endif
+}
+} // namespace detail
+
+} // namespace c_utils
+
+#endif /* QUEUE_DEFINES_HPP_ */
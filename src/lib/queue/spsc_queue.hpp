@@ -0,0 +1,122 @@
+/**
+ * @file spsc_queue.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for define a lock-free Single Producer Single Consumer Queue (FIFO)
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef SPSC_QUEUE_HPP_
+#define SPSC_QUEUE_HPP_
+
+#include "queue/queue_defines.hpp"
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace c_utils {
+
+// Bounded FIFO shared by exactly one producer thread (enqueue/emplace) and one consumer thread (dequeue).
+// The indices run freely and each one is written by a single side, the fill level is their difference so no
+// full flag is shared. Each side keeps a cached copy of the peer index and only reloads it (acquire) when the
+// cached value says the queue is full/empty, so the peer cache line is touched once per batch, not per item.
+template <class T, std::size_t max_size> class SpscQueue {
+  static_assert(max_size > 0, "A queue needs at least 1 slot");
+  static_assert(std::atomic<std::size_t>::is_always_lock_free, "Lock-free indices required");
+
+private:
+  // Producer line: next slot to write and the last tail seen
+  alignas(cache_line_size) std::atomic<std::size_t> _head{ 0 };
+  std::size_t _tail_cache = 0;
+  // Consumer line: next slot to read and the last head seen
+  alignas(cache_line_size) std::atomic<std::size_t> _tail{ 0 };
+  std::size_t _head_cache = 0;
+
+  alignas(cache_line_size) alignas(T) unsigned char _buff[max_size][sizeof(T)];
+
+  T *slot(std::size_t idx) {
+    return std::launder(reinterpret_cast<T *>(_buff[idx % max_size]));
+  }
+
+public:
+  explicit SpscQueue() = default;
+  SpscQueue(SpscQueue const &)            = delete;
+  SpscQueue &operator=(SpscQueue const &) = delete;
+  ~SpscQueue() {
+    std::size_t const head = _head.load(std::memory_order_relaxed);
+    for (std::size_t i = _tail.load(std::memory_order_relaxed); i != head; ++i) slot(i)->~T();
+  }
+
+  // Approximate when called while the other side is running
+  bool empty() const {
+    return (_head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire));
+  }
+  std::size_t size() const {
+    std::size_t const tail = _tail.load(std::memory_order_acquire);
+    return (_head.load(std::memory_order_acquire) - tail);
+  }
+  static constexpr std::size_t capacity() {
+    return max_size;
+  }
+
+  // Producer side: constructs a new(est) element in place if the queue is not full.
+  template <class... Args> bool emplace(Args &&...args) {
+    std::size_t const head = _head.load(std::memory_order_relaxed);
+    if (head - _tail_cache == max_size) {
+      _tail_cache = _tail.load(std::memory_order_acquire);
+      if (head - _tail_cache == max_size) return false;
+    }
+    ::new (static_cast<void *>(_buff[head % max_size])) T(std::forward<Args>(args)...);
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+  bool enqueue(T const &val) {
+    return emplace(val);
+  }
+  bool enqueue(T &&val) {
+    return emplace(std::move(val));
+  }
+
+  // Consumer side: provides (moved) the next (oldest) element in the queue if it's not empty.
+  bool dequeue(T &element) {
+    std::size_t const tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head_cache) {
+      _head_cache = _head.load(std::memory_order_acquire);
+      if (tail == _head_cache) return false;
+    }
+    T *elem = slot(tail);
+    element = std::move(*elem);
+    elem->~T();
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+} // namespace c_utils
+
+#endif /* SPSC_QUEUE_HPP_ */
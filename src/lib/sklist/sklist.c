@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file sklist.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for Skip list implementation
+ *
+ * @see https://en.wikipedia.org/wiki/Skip_list
+ */
+
+#include "sklist.h"
+#include <stdlib.h> /*malloc, free*/
+#include <string.h> /*memcpy*/
+
+#define SKLIST_DEFAULT_SEED (0x9E3779B9U)
+
+/* Levels are drawn with p = 1/4: every pair of zero bits on a xorshift32 draw adds a level */
+static uint8_t sklist_random_level(uint32_t *seed) {
+  uint32_t x     = (0U == *seed) ? SKLIST_DEFAULT_SEED : *seed;
+  uint8_t  level = 1U;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *seed = x;
+
+  while ((level < SKLIST_MAX_LEVEL) && (0U == (x & 3U))) {
+    ++level;
+    x >>= 2;
+  }
+
+  return level;
+}
+
+static sk_node_ptr_t sklist_create_node(sk_key_t key, void *data, uint32_t data_size, uint8_t level) {
+  sk_node_t *new_node = (sk_node_t *)malloc(sizeof(sk_node_t) + (level * sizeof(sk_node_t *)));
+
+  if (NULL != new_node) {
+    new_node->data = malloc(data_size);
+
+    if (NULL != new_node->data) {
+      (void)memcpy(new_node->data, data, data_size);
+      new_node->key   = key;
+      new_node->level = level;
+    } else {
+      free(new_node);
+      new_node = NULL; // Avoid dangling pointer
+    }
+  }
+
+  return new_node;
+}
+
+/* Fills `update` with the link slot (per level) that precedes the first node with a key >= `key` */
+static sk_node_ptr_t sklist_find(sk_handle_t sl, sk_key_t key, sk_node_t **update[]) {
+  sk_node_t **links = sl->head;
+
+  for (int32_t lvl = (int32_t)sl->level - 1; lvl >= 0; --lvl) {
+    while ((NULL != links[lvl]) && (links[lvl]->key < key)) {
+      links = links[lvl]->next;
+    }
+    if (NULL != update) update[lvl] = &links[lvl];
+  }
+
+  return (0U != sl->level) ? links[0] : NULL;
+}
+
+base_t sklist_insert(sk_handle_t sl, sk_key_t key, void *data, uint32_t data_size) {
+  base_t ret_val = NOT_OK;
+
+  if ((NULL != sl) && (NULL != data) && (0 != data_size)) {
+    sk_node_t   **update[SKLIST_MAX_LEVEL];
+    sk_node_ptr_t found = sklist_find(sl, key, update);
+
+    if ((NULL == found) || (found->key != key)) {
+      uint8_t const level = sklist_random_level(&sl->seed);
+      sk_node_ptr_t node  = sklist_create_node(key, data, data_size, level);
+
+      if (NULL != node) {
+        // New levels start from the sentinel
+        for (uint8_t lvl = sl->level; lvl < level; ++lvl) {
+          update[lvl] = &sl->head[lvl];
+        }
+        if (level > sl->level) sl->level = level;
+
+        for (uint8_t lvl = 0U; lvl < level; ++lvl) {
+          node->next[lvl] = *update[lvl];
+          *update[lvl]    = node;
+        }
+        ++sl->size;
+        ret_val = OK;
+      }
+    }
+  }
+
+  return ret_val;
+}
+
+void *sklist_search(sk_handle_t sl, sk_key_t key) {
+  void *data = NULL;
+
+  if (NULL != sl) {
+    sk_node_ptr_t found = sklist_find(sl, key, NULL);
+
+    if ((NULL != found) && (found->key == key)) data = found->data;
+  }
+
+  return data;
+}
+
+base_t sklist_remove(sk_handle_t sl, sk_key_t key, void **data) {
+  base_t ret_val = NOT_OK;
+
+  if (NULL != sl) {
+    sk_node_t   **update[SKLIST_MAX_LEVEL];
+    sk_node_ptr_t found = sklist_find(sl, key, update);
+
+    if ((NULL != found) && (found->key == key)) {
+      for (uint8_t lvl = 0U; lvl < found->level; ++lvl) {
+        *update[lvl] = found->next[lvl];
+      }
+      while ((0U != sl->level) && (NULL == sl->head[sl->level - 1U])) {
+        --sl->level;
+      }
+      --sl->size;
+
+      if (NULL != data) {
+        *data = found->data; // node->data needs to be freed by the user
+      } else {
+        free(found->data);
+      }
+      free(found);
+      ret_val = OK;
+    }
+  }
+
+  return ret_val;
+}
+
+uint32_t sklist_range(sk_handle_t sl, sk_key_t lo, sk_key_t hi, sk_visit_fn_t vfn_ptr, void *ctx) {
+  uint32_t visited = 0U;
+
+  if ((NULL != sl) && (NULL != vfn_ptr)) {
+    sk_node_ptr_t node_ref = sklist_find(sl, lo, NULL);
+
+    while ((NULL != node_ref) && (node_ref->key <= hi)) {
+      ++visited;
+      if (OK != (*vfn_ptr)(node_ref->key, node_ref->data, ctx)) break;
+
+      node_ref = node_ref->next[0];
+    }
+  }
+
+  return visited;
+}
+
+uint32_t sklist_get_size(sk_handle_t sl) {
+  return (NULL != sl) ? sl->size : 0U;
+}
+
+void sklist_delete_list(sk_handle_t sl) {
+  if (NULL != sl) {
+    sk_node_ptr_t current = sl->head[0];
+
+    while (NULL != current) {
+      sk_node_ptr_t next = current->next[0];
+      free(current->data);
+      free(current);
+      current = next;
+    }
+    for (uint8_t lvl = 0U; lvl < SKLIST_MAX_LEVEL; ++lvl) {
+      sl->head[lvl] = NULL;
+    }
+    sl->size  = 0U;
+    sl->level = 0U;
+  }
+}
@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file sklist_conc.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the concurrent Skip list implementation (lazy skip list, fine-grained locking)
+ *
+ * Lookups never lock. Insert and remove lock only the predecessors of the node on each of its levels,
+ * validate them and then link/unlink. Removed nodes are marked first (logical delete) and retired on a
+ * lock-free stack until `sklist_conc_reclaim` is called at a quiescent point.
+ *
+ * @see Herlihy, Lev, Luchangco, Shavit. "A Simple Optimistic Skiplist Algorithm" (2007)
+ */
+
+#include "sklist.h"
+#include <stdatomic.h>
+#include <stdlib.h> /*malloc, free*/
+#include <string.h> /*memcpy*/
+
+#define SKLIST_DEFAULT_SEED (0x9E3779B9U)
+
+struct sk_cnode_s {
+  sk_key_t                    key;
+  void                       *data;         // Any data type
+  struct sk_cnode_s          *retired_next; // Link on the retired stack
+  atomic_flag                 lock;         // Node spinlock, held only while (un)linking
+  atomic_bool                 marked;       // Logically deleted
+  atomic_bool                 fully_linked; // Linked at every level
+  uint8_t                     level;        // Number of forward links held by the node
+  _Atomic(struct sk_cnode_s *) next[];      // Forward links, one per level
+};
+
+typedef struct sk_cnode_s sk_cnode_t;
+
+struct sk_clist_s {
+  sk_cnode_t          *head;    // Sentinel holding SKLIST_MAX_LEVEL links
+  _Atomic(sk_cnode_t *) retired; // Nodes removed but not yet freed
+  atomic_uint          size;
+};
+
+static _Thread_local uint32_t tls_seed = 0U;
+
+static uint8_t sklist_conc_random_level(void) {
+  uint32_t x     = (0U == tls_seed) ? (SKLIST_DEFAULT_SEED ^ (uint32_t)(size_t)&tls_seed) : tls_seed;
+  uint8_t  level = 1U;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  tls_seed = x;
+
+  while ((level < SKLIST_MAX_LEVEL) && (0U == (x & 3U))) {
+    ++level;
+    x >>= 2;
+  }
+
+  return level;
+}
+
+static inline void sklist_conc_lock(sk_cnode_t *node) {
+  while (atomic_flag_test_and_set_explicit(&node->lock, memory_order_acquire)) {
+    // spin, critical sections are a handful of stores
+  }
+}
+
+static inline void sklist_conc_unlock(sk_cnode_t *node) {
+  atomic_flag_clear_explicit(&node->lock, memory_order_release);
+}
+
+/* Unlocks every distinct predecessor locked on levels [0, highest] */
+static void sklist_conc_unlock_preds(sk_cnode_t *preds[], int32_t highest) {
+  sk_cnode_t *prev = NULL;
+
+  for (int32_t lvl = 0; lvl <= highest; ++lvl) {
+    if (preds[lvl] != prev) sklist_conc_unlock(preds[lvl]);
+    prev = preds[lvl];
+  }
+}
+
+static sk_cnode_t *sklist_conc_alloc_node(sk_key_t key, uint8_t level) {
+  sk_cnode_t *node = (sk_cnode_t *)malloc(sizeof(sk_cnode_t) + (level * sizeof(_Atomic(sk_cnode_t *))));
+
+  if (NULL != node) {
+    node->key          = key;
+    node->data         = NULL;
+    node->retired_next = NULL;
+    node->level        = level;
+    atomic_flag_clear(&node->lock);
+    atomic_init(&node->marked, false);
+    atomic_init(&node->fully_linked, false);
+    for (uint8_t lvl = 0U; lvl < level; ++lvl) {
+      atomic_init(&node->next[lvl], NULL);
+    }
+  }
+
+  return node;
+}
+
+static inline void sklist_conc_free_node(sk_cnode_t *node) {
+  free(node->data);
+  free(node);
+}
+
+/* Lock-free search, returns the highest level where the key was found or -1 */
+static int32_t sklist_conc_find(sk_chandle_t sl, sk_key_t key, sk_cnode_t *preds[], sk_cnode_t *succs[]) {
+  int32_t     found = -1;
+  sk_cnode_t *pred  = sl->head;
+
+  for (int32_t lvl = SKLIST_MAX_LEVEL - 1; lvl >= 0; --lvl) {
+    sk_cnode_t *curr = atomic_load_explicit(&pred->next[lvl], memory_order_acquire);
+
+    while ((NULL != curr) && (curr->key < key)) {
+      pred = curr;
+      curr = atomic_load_explicit(&pred->next[lvl], memory_order_acquire);
+    }
+    if ((-1 == found) && (NULL != curr) && (curr->key == key)) found = lvl;
+
+    preds[lvl] = pred;
+    succs[lvl] = curr;
+  }
+
+  return found;
+}
+
+sk_chandle_t sklist_conc_create(void) {
+  sk_chandle_t sl = (sk_chandle_t)malloc(sizeof(sk_clist_t));
+
+  if (NULL != sl) {
+    sl->head = sklist_conc_alloc_node(0, SKLIST_MAX_LEVEL);
+
+    if (NULL != sl->head) {
+      atomic_init(&sl->head->fully_linked, true);
+      atomic_init(&sl->retired, NULL);
+      atomic_init(&sl->size, 0U);
+    } else {
+      free(sl);
+      sl = NULL; // Avoid dangling pointer
+    }
+  }
+
+  return sl;
+}
+
+base_t sklist_conc_insert(sk_chandle_t sl, sk_key_t key, void *data, uint32_t data_size) {
+  if ((NULL == sl) || (NULL == data) || (0 == data_size)) return NOT_OK;
+
+  uint8_t const level = sklist_conc_random_level();
+  sk_cnode_t   *preds[SKLIST_MAX_LEVEL];
+  sk_cnode_t   *succs[SKLIST_MAX_LEVEL];
+  sk_cnode_t   *node  = sklist_conc_alloc_node(key, level);
+
+  // Allocated up-front so no allocation happens while the predecessors are locked
+  if (NULL != node) node->data = malloc(data_size);
+  if ((NULL == node) || (NULL == node->data)) {
+    free(node);
+    return NOT_OK;
+  }
+  (void)memcpy(node->data, data, data_size);
+
+  while (true) {
+    int32_t const found = sklist_conc_find(sl, key, preds, succs);
+
+    if (-1 != found) {
+      sk_cnode_t *existing = succs[found];
+
+      if (!atomic_load_explicit(&existing->marked, memory_order_acquire)) {
+        // Wait for a concurrent insert of the same key to finish before reporting the duplicate
+        while (!atomic_load_explicit(&existing->fully_linked, memory_order_acquire)) {
+        }
+        sklist_conc_free_node(node);
+        return NOT_OK;
+      }
+      continue; // Being removed, retry once it is unlinked
+    }
+
+    int32_t     highest = -1;
+    bool_t      valid   = true;
+    sk_cnode_t *prev    = NULL;
+
+    for (int32_t lvl = 0; valid && (lvl < (int32_t)level); ++lvl) {
+      sk_cnode_t *pred = preds[lvl];
+      sk_cnode_t *succ = succs[lvl];
+
+      if (pred != prev) sklist_conc_lock(pred);
+      highest = lvl;
+      prev    = pred;
+      valid   = !atomic_load_explicit(&pred->marked, memory_order_acquire) &&
+              ((NULL == succ) || !atomic_load_explicit(&succ->marked, memory_order_acquire)) &&
+              (atomic_load_explicit(&pred->next[lvl], memory_order_acquire) == succ);
+    }
+
+    if (!valid) {
+      sklist_conc_unlock_preds(preds, highest);
+      continue;
+    }
+
+    for (uint8_t lvl = 0U; lvl < level; ++lvl) {
+      atomic_store_explicit(&node->next[lvl], succs[lvl], memory_order_relaxed);
+    }
+    // Publish bottom-up so a reader reaching the node at any level can walk down from it
+    for (uint8_t lvl = 0U; lvl < level; ++lvl) {
+      atomic_store_explicit(&preds[lvl]->next[lvl], node, memory_order_release);
+    }
+    atomic_store_explicit(&node->fully_linked, true, memory_order_release);
+    atomic_fetch_add_explicit(&sl->size, 1U, memory_order_relaxed);
+
+    sklist_conc_unlock_preds(preds, highest);
+    return OK;
+  }
+}
+
+void *sklist_conc_search(sk_chandle_t sl, sk_key_t key) {
+  void *data = NULL;
+
+  if (NULL != sl) {
+    sk_cnode_t   *preds[SKLIST_MAX_LEVEL];
+    sk_cnode_t   *succs[SKLIST_MAX_LEVEL];
+    int32_t const found = sklist_conc_find(sl, key, preds, succs);
+
+    if ((-1 != found) && atomic_load_explicit(&succs[found]->fully_linked, memory_order_acquire) &&
+        !atomic_load_explicit(&succs[found]->marked, memory_order_acquire)) {
+      data = succs[found]->data;
+    }
+  }
+
+  return data;
+}
+
+base_t sklist_conc_remove(sk_chandle_t sl, sk_key_t key) {
+  if (NULL == sl) return NOT_OK;
+
+  sk_cnode_t *preds[SKLIST_MAX_LEVEL];
+  sk_cnode_t *succs[SKLIST_MAX_LEVEL];
+  sk_cnode_t *victim    = NULL;
+  bool_t      is_marked = false;
+  int32_t     top       = -1;
+
+  while (true) {
+    int32_t const found = sklist_conc_find(sl, key, preds, succs);
+
+    if (!is_marked) {
+      if (-1 == found) return NOT_OK;
+
+      victim = succs[found];
+      // Only a fully linked node found at its top level is a removal candidate
+      if (!atomic_load_explicit(&victim->fully_linked, memory_order_acquire) ||
+          ((int32_t)victim->level - 1 != found) ||
+          atomic_load_explicit(&victim->marked, memory_order_acquire)) {
+        return NOT_OK;
+      }
+
+      top = (int32_t)victim->level - 1;
+      sklist_conc_lock(victim);
+      if (atomic_load_explicit(&victim->marked, memory_order_acquire)) {
+        sklist_conc_unlock(victim);
+        return NOT_OK; // Somebody else won the removal
+      }
+      atomic_store_explicit(&victim->marked, true, memory_order_release);
+      is_marked = true;
+    }
+
+    int32_t     highest = -1;
+    bool_t      valid   = true;
+    sk_cnode_t *prev    = NULL;
+
+    for (int32_t lvl = 0; valid && (lvl <= top); ++lvl) {
+      sk_cnode_t *pred = preds[lvl];
+
+      if (pred != prev) sklist_conc_lock(pred);
+      highest = lvl;
+      prev    = pred;
+      valid   = !atomic_load_explicit(&pred->marked, memory_order_acquire) &&
+              (atomic_load_explicit(&pred->next[lvl], memory_order_acquire) == victim);
+    }
+
+    if (!valid) {
+      sklist_conc_unlock_preds(preds, highest);
+      continue;
+    }
+
+    for (int32_t lvl = top; lvl >= 0; --lvl) {
+      sk_cnode_t *succ = atomic_load_explicit(&victim->next[lvl], memory_order_acquire);
+      atomic_store_explicit(&preds[lvl]->next[lvl], succ, memory_order_release);
+    }
+    atomic_fetch_sub_explicit(&sl->size, 1U, memory_order_relaxed);
+
+    sklist_conc_unlock(victim);
+    sklist_conc_unlock_preds(preds, highest);
+
+    // Retire (Treiber push), readers may still hold a reference to the victim
+    sk_cnode_t *retired = atomic_load_explicit(&sl->retired, memory_order_relaxed);
+    do {
+      victim->retired_next = retired;
+    } while (!atomic_compare_exchange_weak_explicit(&sl->retired, &retired, victim, memory_order_release,
+                                                    memory_order_relaxed));
+    return OK;
+  }
+}
+
+uint32_t sklist_conc_range(sk_chandle_t sl, sk_key_t lo, sk_key_t hi, sk_visit_fn_t vfn_ptr, void *ctx) {
+  uint32_t visited = 0U;
+
+  if ((NULL != sl) && (NULL != vfn_ptr)) {
+    sk_cnode_t *preds[SKLIST_MAX_LEVEL];
+    sk_cnode_t *succs[SKLIST_MAX_LEVEL];
+    (void)sklist_conc_find(sl, lo, preds, succs);
+
+    sk_cnode_t *node_ref = succs[0];
+
+    while ((NULL != node_ref) && (node_ref->key <= hi)) {
+      if (atomic_load_explicit(&node_ref->fully_linked, memory_order_acquire) &&
+          !atomic_load_explicit(&node_ref->marked, memory_order_acquire)) {
+        ++visited;
+        if (OK != (*vfn_ptr)(node_ref->key, node_ref->data, ctx)) break;
+      }
+      node_ref = atomic_load_explicit(&node_ref->next[0], memory_order_acquire);
+    }
+  }
+
+  return visited;
+}
+
+uint32_t sklist_conc_get_size(sk_chandle_t sl) {
+  return (NULL != sl) ? atomic_load_explicit(&sl->size, memory_order_relaxed) : 0U;
+}
+
+void sklist_conc_reclaim(sk_chandle_t sl) {
+  if (NULL != sl) {
+    sk_cnode_t *current = atomic_exchange_explicit(&sl->retired, NULL, memory_order_acquire);
+
+    while (NULL != current) {
+      sk_cnode_t *next = current->retired_next;
+      sklist_conc_free_node(current);
+      current = next;
+    }
+  }
+}
+
+void sklist_conc_destroy(sk_chandle_t *sl) {
+  if ((NULL != sl) && (NULL != *sl)) {
+    sk_cnode_t *current = atomic_load_explicit(&(*sl)->head->next[0], memory_order_acquire);
+
+    while (NULL != current) {
+      sk_cnode_t *next = atomic_load_explicit(&current->next[0], memory_order_relaxed);
+      sklist_conc_free_node(current);
+      current = next;
+    }
+    sklist_conc_reclaim(*sl);
+    free((*sl)->head);
+    free(*sl);
+    *sl = NULL;
+  }
+}
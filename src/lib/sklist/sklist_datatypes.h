@@ -0,0 +1,58 @@
+/**
+ * @file sklist_datatypes.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Skip List Data Types
+ *
+ */
+
+#ifndef SKLIST_DATATYPES_H_
+#define SKLIST_DATATYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Includes
+#include "utils_common.h"
+
+/* Max number of forward links per node. With p = 1/4 this covers ~4^16 keys */
+#ifndef SKLIST_MAX_LEVEL
+  #define SKLIST_MAX_LEVEL (16U)
+#endif
+
+typedef int64_t sk_key_t;
+
+typedef struct sk_node_s sk_node_t;
+
+typedef sk_node_t *sk_node_ptr_t;
+
+struct sk_node_s {
+  sk_key_t   key;
+  void      *data;   // Any data type
+  uint8_t    level;  // Number of forward links held by the node
+  sk_node_t *next[]; // Forward links, one per level
+};
+
+typedef struct sk_list_s {
+  sk_node_t *head[SKLIST_MAX_LEVEL]; // Sentinel forward links (no node allocated for the head)
+  uint32_t   size;                   // Number of nodes in the list
+  uint32_t   seed;                   // Level generator state, 0 picks a default seed
+  uint8_t    level;                  // Highest level currently in use
+} sk_list_t;
+
+typedef sk_list_t *sk_handle_t;
+
+/* Concurrent (fine-grained locking) variant, layout is private to sklist_conc.c */
+typedef struct sk_clist_s sk_clist_t;
+
+typedef sk_clist_t *sk_chandle_t;
+
+/* Visitor used on range iteration. Returning other than OK stops the iteration */
+typedef base_t (*sk_visit_fn_t)(sk_key_t key, void *data, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SKLIST_DATATYPES_H_ */
@@ -0,0 +1,36 @@
+/**
+ * @file sklist_defines.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Skip list macro definitions
+ *
+ */
+
+#ifndef SKLIST_DEFINES_H_
+#define SKLIST_DEFINES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define _SKLIST_DEF_TYPE(type, list)                                                   \
+  base_t sklist_remove_refd_##list(sk_handle_t sl, sk_key_t key, type *ref) {          \
+    void  *_ptr = NULL;                                                                \
+    base_t ret  = sklist_remove(sl, key, &_ptr);                                       \
+    if (0 == ret) *ref = *(type *)_ptr;                                                \
+    free(_ptr);                                                                        \
+    return ret;                                                                        \
+  }                                                                                    \
+  base_t sklist_search_refd_##list(sk_handle_t sl, sk_key_t key, type *ref) {          \
+    type *_ptr = (type *)sklist_search(sl, key);                                       \
+    if (NULL == _ptr) return 1;                                                        \
+    *ref = *_ptr;                                                                      \
+    return 0;                                                                          \
+  }                                                                                    \
+  sk_list_t list = { { NULL }, 0U, 0U, 0U }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SKLIST_DEFINES_H_ */
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file twheel.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for the Hierarchical Timing Wheel, O(1) add/cancel and lazy cascading between levels
+ *
+ */
+
+#include "twheel.h"
+
+_Static_assert(TWHEEL_SLOTS <= 64, "The first level occupancy is a uint64_t bitmap");
+
+static inline uint32_t twheel_ctz(uint64_t bits) {
+#if defined(__GNUC__)
+  return (uint32_t)__builtin_ctzll(bits);
+#else
+  uint32_t count = 0;
+  while (0 == (bits & 1U)) {
+    bits >>= 1;
+    ++count;
+  }
+  return count;
+#endif
+}
+
+/* Removes a timer from the list it's linked in (a wheel slot or a batch being expired) */
+static inline void twheel_unlink(tw_timer_t *timer) {
+  twheel_t *wheel = timer->wheel;
+
+  *timer->pprev = timer->next;
+  if (NULL != timer->next) timer->next->pprev = timer->pprev;
+  timer->next  = NULL;
+  timer->pprev = NULL;
+  if ((timer->slot < TWHEEL_SLOTS) && (NULL == wheel->slots[0][timer->slot].first)) {
+    wheel->occupied &= ~(1ULL << timer->slot);
+  }
+  --wheel->count;
+}
+
+/* Links a timer in the slot of its expiration: the first level whose range holds the remaining ticks */
+static inline void twheel_place(twheel_t *wheel, tw_timer_t *timer) {
+  uint64_t const delta = timer->expires - wheel->now;
+  uint32_t       level = 0;
+
+  while ((level < (TWHEEL_LEVELS - 1)) && (delta >> (TWHEEL_SLOT_BITS * (level + 1)))) ++level;
+
+  uint32_t const idx  = (uint32_t)(timer->expires >> (TWHEEL_SLOT_BITS * level)) & TWHEEL_SLOT_MASK;
+  tw_slot_t     *slot = &wheel->slots[level][idx];
+
+  timer->next = slot->first;
+  if (NULL != slot->first) slot->first->pprev = &timer->next;
+  slot->first  = timer;
+  timer->pprev = &slot->first;
+  timer->slot  = (uint16_t)(level * TWHEEL_SLOTS + idx);
+  if (0 == level) wheel->occupied |= (1ULL << idx);
+  ++wheel->count;
+}
+
+/* Moves the whole slot to a batch list (O(1)), the batch timers keep their slot field */
+static inline void twheel_take(tw_slot_t *slot, tw_slot_t *batch) {
+  batch->first = slot->first;
+  slot->first  = NULL;
+  if (NULL != batch->first) batch->first->pprev = &batch->first;
+}
+
+/* The first level wrapped: the current slot of the next level is distributed on the lower levels, and the
+ * same for the following level when that one wraps too. */
+static void twheel_cascade(twheel_t *wheel) {
+  for (uint32_t level = 1; level < TWHEEL_LEVELS; ++level) {
+    uint32_t const idx   = (uint32_t)(wheel->now >> (TWHEEL_SLOT_BITS * level)) & TWHEEL_SLOT_MASK;
+    tw_slot_t      batch = { NULL };
+
+    twheel_take(&wheel->slots[level][idx], &batch);
+    while (NULL != batch.first) {
+      tw_timer_t *timer = batch.first;
+      twheel_unlink(timer);
+      twheel_place(wheel, timer);
+    }
+    if (0 != idx) break;
+  }
+}
+
+/* Expires the current slot of the first level as a batch */
+static uint32_t twheel_expire(twheel_t *wheel) {
+  uint32_t const idx     = (uint32_t)wheel->now & TWHEEL_SLOT_MASK;
+  uint32_t       expired = 0;
+  tw_slot_t      batch   = { NULL };
+
+  twheel_take(&wheel->slots[0][idx], &batch);
+  wheel->occupied &= ~(1ULL << idx);
+  while (NULL != batch.first) {
+    tw_timer_t *timer = batch.first;
+    twheel_unlink(timer);
+    ++expired;
+    timer->fn(timer, timer->ctx); // Can add or cancel timers, including the ones left in the batch
+  }
+  return expired;
+}
+
+base_t twheel_init(twheel_t *wheel, uint64_t now) {
+  base_t ret = NOT_OK;
+
+  if (NULL != wheel) {
+    for (uint32_t level = 0; level < TWHEEL_LEVELS; ++level) {
+      for (uint32_t idx = 0; idx < TWHEEL_SLOTS; ++idx) wheel->slots[level][idx].first = NULL;
+    }
+    wheel->occupied = 0;
+    wheel->now      = now;
+    wheel->count    = 0;
+    ret             = OK;
+  }
+  return ret;
+}
+
+base_t twheel_timer_init(tw_timer_t *timer, tw_expire_fn_t fn, void *ctx) {
+  base_t ret = NOT_OK;
+
+  if ((NULL != timer) && (NULL != fn)) {
+    timer->next    = NULL;
+    timer->pprev   = NULL;
+    timer->wheel   = NULL;
+    timer->expires = 0;
+    timer->fn      = fn;
+    timer->ctx     = ctx;
+    timer->slot    = 0;
+    ret            = OK;
+  }
+  return ret;
+}
+
+base_t twheel_add(twheel_t *wheel, tw_timer_t *timer, uint64_t delay) {
+  base_t ret = NOT_OK;
+
+  if ((NULL != wheel) && (NULL != timer) && (NULL != timer->fn)) {
+    if (NULL != timer->pprev) twheel_unlink(timer);
+    if (0 == delay) delay = 1;
+    if (TWHEEL_MAX_DELAY < delay) delay = TWHEEL_MAX_DELAY;
+
+    timer->wheel   = wheel;
+    timer->expires = wheel->now + delay;
+    twheel_place(wheel, timer);
+    ret = OK;
+  }
+  return ret;
+}
+
+base_t twheel_cancel(tw_timer_t *timer) {
+  base_t ret = NOT_OK;
+
+  if ((NULL != timer) && (NULL != timer->pprev)) {
+    twheel_unlink(timer);
+    ret = OK;
+  }
+  return ret;
+}
+
+bool_t twheel_pending(tw_timer_t const *timer) {
+  return ((NULL != timer) && (NULL != timer->pprev));
+}
+
+uint32_t twheel_advance(twheel_t *wheel, uint64_t ticks) {
+  uint32_t expired = 0;
+
+  while ((NULL != wheel) && (0 < ticks)) {
+    if (0 == wheel->count) {
+      wheel->now += ticks; // Nothing to cascade or expire
+      break;
+    }
+    // Skips the empty slots of the first level up to its wrap
+    uint32_t const next = (uint32_t)(wheel->now + 1U) & TWHEEL_SLOT_MASK;
+    if (0 != next) {
+      uint64_t const pending = wheel->occupied >> next;
+      uint64_t       skip    = (0 == pending) ? (TWHEEL_SLOTS - next) : twheel_ctz(pending);
+      if (skip > ticks) skip = ticks;
+      wheel->now += skip;
+      ticks      -= skip;
+      if (0 == ticks) break;
+    }
+
+    ++wheel->now;
+    --ticks;
+    if (0 == (wheel->now & TWHEEL_SLOT_MASK)) twheel_cascade(wheel);
+    expired += twheel_expire(wheel);
+  }
+  return expired;
+}
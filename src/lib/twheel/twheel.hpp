@@ -0,0 +1,109 @@
+/**
+ * @file twheel.hpp
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for the C++ wrapper of the Hierarchical Timing Wheel
+ *
+ */
+
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+#ifndef TWHEEL_HPP_
+#define TWHEEL_HPP_
+
+#include "twheel.h"
+#include <cstdint>
+#include <utility>
+
+namespace c_utils {
+
+// Timer calling fn() on its expiration, same core as the C API (tw_timer_t). Intrusive so it can't be
+// copied or moved while pending; it's cancelled when destroyed.
+//   c_utils::Timer timeout([&conn]() { conn.close(); });
+//   wheel.add(timeout, 30 * ticks_per_sec);
+template <class F> class Timer {
+public:
+  explicit Timer(F fn) : _fn(std::move(fn)) {
+    twheel_timer_init(&_timer, &Timer::expire, this);
+  }
+  Timer(Timer const &)            = delete;
+  Timer &operator=(Timer const &) = delete;
+  ~Timer() {
+    twheel_cancel(&_timer);
+  }
+
+  bool pending() const {
+    return twheel_pending(&_timer);
+  }
+  bool cancel() {
+    return (OK == twheel_cancel(&_timer));
+  }
+  tw_timer_t *handle() {
+    return &_timer;
+  }
+
+private:
+  tw_timer_t _timer;
+  F          _fn;
+
+  static void expire(tw_timer_t *, void *ctx) {
+    static_cast<Timer *>(ctx)->_fn();
+  }
+};
+
+// Owns the wheel state, shall outlive the timers added to it
+class TimingWheel {
+public:
+  explicit TimingWheel(uint64_t now = 0) {
+    twheel_init(&_wheel, now);
+  }
+  TimingWheel(TimingWheel const &)            = delete;
+  TimingWheel &operator=(TimingWheel const &) = delete;
+
+  // Adds (or re-arms) the timer to expire delay ticks from now
+  template <class F> void add(Timer<F> &timer, uint64_t delay) {
+    twheel_add(&_wheel, timer.handle(), delay);
+  }
+  // Advances ticks and expires the due timers, returns how many expired
+  uint32_t advance(uint64_t ticks) {
+    return twheel_advance(&_wheel, ticks);
+  }
+  uint64_t now() const {
+    return _wheel.now;
+  }
+  uint32_t size() const {
+    return _wheel.count;
+  }
+  twheel_t *handle() {
+    return &_wheel;
+  }
+
+private:
+  twheel_t _wheel;
+};
+
+} // namespace c_utils
+
+#endif /* TWHEEL_HPP_ */
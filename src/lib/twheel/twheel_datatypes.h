@@ -0,0 +1,47 @@
+/**
+ * @file twheel_datatypes.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Hierarchical Timing Wheel datatypes definition
+ *
+ */
+
+#ifndef TWHEEL_DATATYPES_H_
+#define TWHEEL_DATATYPES_H_
+
+// Includes
+#include "utils_common.h"
+#include "twheel/twheel_defines.h"
+#include <stddef.h>
+
+typedef struct tw_timer_s tw_timer_t;
+typedef struct twheel_s   twheel_t;
+
+/* Called once the timer expires, the timer is already out of the wheel and can be added again */
+typedef void (*tw_expire_fn_t)(tw_timer_t *timer, void *ctx);
+
+/* Head of a slot, intrusive list of timers. NULL when empty so a zeroed wheel is valid */
+typedef struct tw_slot_s {
+  tw_timer_t *first;
+} tw_slot_t;
+
+/* Timer embedded by the user in its own data (intrusive), the wheel doesn't allocate */
+struct tw_timer_s {
+  tw_timer_t    *next;    // Next timer in the slot
+  tw_timer_t   **pprev;   // Link pointing to this timer (slot first or previous next), NULL if not pending
+  twheel_t      *wheel;   // Wheel the timer is pending on
+  uint64_t       expires; // Absolute tick of the expiration
+  tw_expire_fn_t fn;      // Expiration callback
+  void          *ctx;     // User context for the callback
+  uint16_t       slot;    // level * TWHEEL_SLOTS + index
+};
+
+/* Wheel level l covers the delays up to 64^(l + 1) ticks with slots of 64^l ticks */
+struct twheel_s {
+  tw_slot_t slots[TWHEEL_LEVELS][TWHEEL_SLOTS];
+  uint64_t  occupied; // Non empty slots of the first level, bit i for slot i
+  uint64_t  now;      // Current tick
+  uint32_t  count;    // Pending timers
+};
+
+#endif /* TWHEEL_DATATYPES_H_ */
@@ -0,0 +1,29 @@
+/**
+ * @file twheel_defines.h
+ * @author Salvador Z
+ * @version 1.0
+ * @brief File for Hierarchical Timing Wheel definitions and macros
+ *
+ */
+
+#ifndef TWHEEL_DEFINES_H_
+#define TWHEEL_DEFINES_H_
+
+#define TWHEEL_SLOT_BITS (6) // 64 slots per level, one bit each in a uint64_t
+#define TWHEEL_SLOTS     (1U << TWHEEL_SLOT_BITS)
+#define TWHEEL_SLOT_MASK (TWHEEL_SLOTS - 1U)
+#define TWHEEL_LEVELS    (4) // Delays up to 64^4 - 1 ticks, longer ones are clamped
+#define TWHEEL_MAX_DELAY ((1ULL << (TWHEEL_SLOT_BITS * TWHEEL_LEVELS)) - 1U)
+
+// clang-format off
+
+#define _TWHEEL_DEF_WHEEL(wheel)                    \
+  twheel_t wheel = {                                \
+    .slots    = { { { NULL } } },                   \
+    .occupied = 0,                                  \
+    .now      = 0,                                  \
+    .count    = 0,                                  \
+  }
+
+// clang-format on
+#endif /* TWHEEL_DEFINES_H_ */
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_hmap.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for testing the hmap library.
+ */
+
+#include "hmap.h"
+#include "uTest.h"
+#include <stdlib.h> /* malloc, free*/
+
+#define MAP_SIZE    (64U)
+#define MAP_BUCKETS (16U)
+#define MAX_KEYS    (1000U)
+
+typedef struct my_struct {
+  uint8_t  dummy;
+  uint32_t data;
+} my_struct_t;
+
+typedef struct big_struct {
+  uint32_t id;
+  uint8_t  payload[512];
+} big_struct_t;
+
+HMAP_CREATE(uint32_t, my_struct_t, my_map, MAP_SIZE);
+
+HMAP_CREATE(uint64_t, uint8_t, small_map, 16);
+
+HMAP_CHAIN_CREATE(uint32_t, big_struct_t, big_map, MAP_BUCKETS);
+
+void fn_test_hmap_with_macros(void) {
+  my_struct_t obj   = { 0 };
+  uint32_t    key   = 0;
+  uint32_t    limit = MAP_SIZE - (MAP_SIZE / 8);
+
+  for (key = 0; key < limit; ++key) {
+    obj.data = key * 3;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_PUT(my_map, &key, &obj), "Failed to put");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(limit, hmap_size(&my_map), "Map shall hold 7/8 of its capacity");
+  // The Map should be full
+  TEST_ASSERT_EQUAL_VAL_MSG(BUSY_W, HMAP_PUT(my_map, &key, &obj), "Map shall be full");
+
+  // Updating an existing key does not need space
+  key      = 5;
+  obj.data = 500;
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_PUT(my_map, &key, &obj), "Failed to update");
+  TEST_ASSERT_EQUAL_VAL_MSG(limit, hmap_size(&my_map), "Update shall not increase the size");
+
+  for (key = 0; key < limit; ++key) {
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_GET(my_map, &key, &obj), "Failed to get");
+    TEST_ASSERT_EQUAL_VAL_MSG((5 == key) ? 500 : key * 3, obj.data, "Value stored under the key");
+  }
+  key = limit + 1;
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, HMAP_GET(my_map, &key, &obj), "Key not present");
+
+  // Remove and insert several times so tombstones get reused
+  for (uint32_t round = 0; round < 10; ++round) {
+    for (key = 0; key < limit; key += 2) {
+      TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_REMOVE(my_map, &key), "Failed to remove");
+    }
+    TEST_ASSERT_EQUAL_VAL_MSG(limit / 2, hmap_size(&my_map), "Half of the keys removed");
+    for (key = 0; key < limit; key += 2) {
+      obj.data = key * 3;
+      TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_PUT(my_map, &key, &obj), "Failed to put after remove");
+    }
+  }
+  for (key = 1; key < limit; key += 2) {
+    TEST_ASSERT_EQUAL_MSG(true, NULL != hmap_find(&my_map, &key), "Odd keys kept across the rounds");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, HMAP_REMOVE(my_map, &limit), "Key not present");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, hmap_reset(&my_map), "Reset");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, hmap_size(&my_map), "Map shall be empty");
+}
+
+void fn_test_hmap_churn(void) {
+  my_struct_t obj   = { 0 };
+  uint32_t    limit = MAP_SIZE - (MAP_SIZE / 8);
+  uint32_t    key   = 0;
+  uint32_t    busy  = 0;
+  uint32_t    lost  = 0;
+
+  // Fresh keys every round, the tombstones left by the removed ones shall not take the room
+  hmap_reset(&my_map);
+  for (uint32_t round = 0; round < 50; ++round) {
+    uint32_t const first = round * limit;
+
+    for (key = first; key < first + limit; ++key) {
+      obj.data = key;
+      if (OK != HMAP_PUT(my_map, &key, &obj)) ++busy;
+    }
+    for (key = first; key < first + limit; ++key) {
+      if ((OK != HMAP_GET(my_map, &key, &obj)) || (key != obj.data)) ++lost;
+      HMAP_REMOVE(my_map, &key);
+    }
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, busy, "Every fresh key inserted");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, lost, "Every key found after the tombstones were dropped");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, hmap_size(&my_map), "Map shall be empty");
+
+  // Half of the keys kept across the rounds, they shall survive the in place rehash
+  for (key = 0; key < limit / 2; ++key) HMAP_PUT(my_map, &key, &obj);
+  for (uint32_t round = 1; round < 50; ++round) {
+    uint32_t const first = round * limit;
+
+    for (key = first; key < first + limit / 2; ++key) {
+      if (OK != HMAP_PUT(my_map, &key, &obj)) ++busy;
+    }
+    for (key = first; key < first + limit / 2; ++key) HMAP_REMOVE(my_map, &key);
+  }
+  for (key = 0; key < limit / 2; ++key) {
+    if (NULL == hmap_find(&my_map, &key)) ++lost;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, busy, "Every fresh key inserted next to the kept ones");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, lost, "Kept keys found");
+  TEST_ASSERT_EQUAL_VAL_MSG(limit / 2, hmap_size(&my_map), "Only the kept keys");
+  hmap_reset(&my_map);
+}
+
+void fn_test_hmap_using_init(void) {
+  uint8_t   ctrl[1024];
+  uint64_t *slots  = (uint64_t *)malloc(1024 * 2 * sizeof(uint64_t));
+  hmap_t    map    = { 0 };
+  uint64_t  val    = 0;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, hmap_init(&map, ctrl, slots, 1000, 8, 16, 8, 8), "Not a power of two");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, hmap_init(&map, ctrl, slots, 1024, 8, 16, 8, 8), "Init failed");
+
+  for (uint64_t key = 0; key < 896; ++key) {
+    uint64_t const big_key = key * 0x100000001ULL;
+    val                    = ~key;
+    TEST_ASSERT_EQUAL_VAL(OK, hmap_put(&map, &big_key, &val));
+  }
+  for (uint64_t key = 0; key < 896; ++key) {
+    uint64_t const big_key = key * 0x100000001ULL;
+    TEST_ASSERT_EQUAL_VAL(OK, hmap_get(&map, &big_key, &val));
+    TEST_ASSERT_EQUAL_VAL(~key, val);
+  }
+  // Testing error
+  TEST_ASSERT_EQUAL_VAL(NOT_OK, hmap_put(&map, NULL, &val));
+  TEST_ASSERT_EQUAL_VAL(NOT_OK, hmap_put(NULL, &val, &val));
+  free(slots);
+}
+
+void fn_test_hmap_small_value(void) {
+  // The slot {uint64_t, uint8_t} has 7 bytes of padding after the value, only the value is copied
+  struct {
+    uint8_t val;
+    uint8_t guard[7];
+  } out        = { 0, { 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5 } };
+  uint64_t key = 0;
+  uint8_t  val = 0;
+  uint32_t bad = 0;
+
+  for (key = 0; key < 14; ++key) {
+    val = (uint8_t)(key + 100);
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_PUT(small_map, &key, &val), "Failed to put");
+  }
+  for (key = 0; key < 14; ++key) {
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_GET(small_map, &key, &out.val), "Failed to get");
+    TEST_ASSERT_EQUAL_VAL_MSG(key + 100, out.val, "Value stored under the key");
+  }
+  for (uint32_t i = 0; i < sizeof(out.guard); ++i) {
+    if (0xA5 != out.guard[i]) ++bad;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, bad, "Get shall not write past the value");
+}
+
+void fn_test_hmap_chain(void) {
+  big_struct_t obj = { 0 };
+  uint32_t     key = 0;
+
+  for (key = 0; key < MAX_KEYS; ++key) {
+    obj.id         = key;
+    obj.payload[0] = (uint8_t)key;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_PUT(big_map, &key, &obj), "Failed to put");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_KEYS, hmap_chain_size(&big_map), "Chained map holds more keys than buckets");
+
+  for (key = 0; key < MAX_KEYS; ++key) {
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_GET(big_map, &key, &obj), "Failed to get");
+    TEST_ASSERT_EQUAL_VAL_MSG(key, obj.id, "Value stored under the key");
+    TEST_ASSERT_EQUAL_VAL_MSG((uint8_t)key, obj.payload[0], "Payload stored under the key");
+  }
+  for (key = 0; key < MAX_KEYS; key += 2) {
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, HMAP_REMOVE(big_map, &key), "Failed to remove");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_KEYS / 2, hmap_chain_size(&big_map), "Half of the keys removed");
+  key = 0;
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, HMAP_GET(big_map, &key, &obj), "Key removed");
+  key = 1;
+  TEST_ASSERT_EQUAL_MSG(true, NULL != hmap_chain_find(&big_map, &key), "Odd keys kept");
+
+  hmap_chain_delete(&big_map);
+  TEST_ASSERT_EQUAL_VAL_MSG(0, hmap_chain_size(&big_map), "Map shall be empty");
+  TEST_ASSERT_EQUAL_MSG(NULL, hmap_chain_find(&big_map, &key), "Map is empty, shall return NULL");
+}
+
+int main() {
+  uTEST_INIT("test_hmap.c");
+  uTEST_ADD_MSG(fn_test_hmap_with_macros, "Open addressing hash map test with macros");
+  uTEST_ADD_MSG(fn_test_hmap_churn, "Open addressing hash map test with fresh keys churn");
+  uTEST_ADD_MSG(fn_test_hmap_using_init, "Open addressing hash map test using init and no macros");
+  uTEST_ADD_MSG(fn_test_hmap_small_value, "Open addressing hash map test with a value smaller than the key");
+  uTEST_ADD_MSG(fn_test_hmap_chain, "Chained hash map test with macros");
+  return (uTEST_END());
+}
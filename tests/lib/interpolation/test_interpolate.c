@@ -32,6 +32,7 @@
 
 #include "interpolate.h"
 #include "uTest.h"
+#include <math.h> /* NAN */
 
 /*
 Steering Problem
@@ -159,6 +160,551 @@ void steering_test_interpolation_with_errors(void) {
 
   // check that our result is correct (within floating point error)
   TEST_ASSERT_EQUAL_FLOAT_MSG(v_expected, v_test, "Testing with Size error");
+
+  // A NaN input is in no segment, on a single sample table as well
+  a      = NAN;
+  v_test = interpolated_estimate(a, a_data, v_data, 5);
+  TEST_ASSERT_EQUAL_FLOAT_MSG(v_expected, v_test, "NaN angle");
+  v_test = interpolated_estimate(a, a_data, v_data, 1);
+  TEST_ASSERT_EQUAL_FLOAT_MSG(v_expected, v_test, "NaN angle on a single sample table");
+}
+
+#define CAL_LEN (1000)
+
+void calibration_table_test(void) {
+  static float        uniform_x[CAL_LEN];
+  static float        irregular_x[CAL_LEN];
+  static float        y[CAL_LEN];
+  static interp_seg_t uni_segs[CAL_LEN - 1];
+  static interp_seg_t irr_segs[CAL_LEN - 1];
+  interp_table_t      uni = { 0 };
+  interp_table_t      irr = { 0 };
+
+  for (int i = 0; i < CAL_LEN; ++i) {
+    uniform_x[i]   = -5.0f + (0.25f * (float)i);
+    irregular_x[i] = (float)i + ((float)(i * i) / 100.0f);
+    y[i]           = (float)((i * 37) % 101) - 50.0f;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_table_init(&uni, uni_segs, uniform_x, y, CAL_LEN),
+                            "Uniform table");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_table_init(&irr, irr_segs, irregular_x, y, CAL_LEN),
+                            "Irregular table");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, 0.0f != uni.inv_step, "Uniform spacing shall be detected");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, 0.0f == irr.inv_step, "Irregular spacing shall be detected");
+
+  int mismatches = 0;
+  for (int i = -20; i < (CAL_LEN * 8) + 20; ++i) {
+    float const xu = -5.0f + (0.25f * (float)i / 8.0f);
+    float const xi = (float)i / 8.0f * 1.9f;
+    // Segment lookup
+    int const su = interpolated_table_segment(xu, &uni);
+    if ((xu > uniform_x[0]) && (xu < uniform_x[CAL_LEN - 1]) &&
+        !((uniform_x[su] <= xu) && (xu < uniform_x[su + 1])))
+      ++mismatches;
+    // Same results as the stateless API
+    if (interpolated_table_estimate(xu, &uni) != interpolated_estimate(xu, uniform_x, y, CAL_LEN))
+      ++mismatches;
+    if (interpolated_table_estimate(xi, &irr) != interpolated_estimate(xi, irregular_x, y, CAL_LEN))
+      ++mismatches;
+  }
+  // A NaN is in no segment on both the uniform and the irregular search
+  if (interpolated_table_estimate(NAN, &uni) != interpolated_estimate(NAN, uniform_x, y, CAL_LEN))
+    ++mismatches;
+  if (interpolated_table_estimate(-NAN, &irr) != interpolated_estimate(-NAN, irregular_x, y, CAL_LEN))
+    ++mismatches;
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Table lookup shall match the stateless estimation");
+
+  // Breakpoints are LUT hits
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[500], interpolated_table_estimate(uniform_x[500], &uni), "Uniform LUT hit");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[777], interpolated_table_estimate(irregular_x[777], &irr), "Irregular hit");
+
+}
+
+INTERP_TABLE_CREATE(steering_lut, 5);
+
+void steering_table_test(void) {
+  const float a_data[]   = { -22, -11, 0, 10, 20 };   // x-axis data
+  const float v_data[]   = { -1.5, -1, 0, 1.2, 1.8 }; // y-axis data
+  const float a_repeat[] = { -22, -11, 0, 0, 20 };    // delta_x = 0
+  const float a_unsort[] = { -22, 0, -11, 10, 20 };   // not increasing
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, INTERP_TABLE_BUILD(steering_lut, a_repeat, v_data), "Repeated sample");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, INTERP_TABLE_BUILD(steering_lut, a_unsort, v_data), "Unsorted domain");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, INTERP_TABLE_BUILD(steering_lut, NULL, v_data), "Table data error");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, interpolated_table_estimate(5.0f, &steering_lut), "Table not built");
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, INTERP_TABLE_BUILD(steering_lut, a_data, v_data), "Steering table");
+  TEST_ASSERT_EQUAL_VAL_MSG(5, steering_lut.length, "Length from the table storage");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.12f, steering_lut.segs[2].m, "Precomputed slope");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, steering_lut.segs[2].k, "Precomputed intercept");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(1.2f, interpolated_table_estimate(10.0f, &steering_lut), "Angle in LUT");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(1.5f, interpolated_table_estimate(15.0f, &steering_lut), "Interpolation");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.6f, interpolated_table_estimate(5.0f, &steering_lut), "Interpolation");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(1.8f, interpolated_table_estimate(35.0f, &steering_lut), "Saturated high");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(-1.5f, interpolated_table_estimate(-30.0f, &steering_lut), "Saturated low");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, interpolated_table_estimate(5.0f, NULL), "Table error");
+}
+
+#define BATCH_LEN (1003) // Not a multiple of the vector width, so all the kernels and the tail are used
+
+void batch_table_test(void) {
+  static float        uniform_x[CAL_LEN];
+  static float        irregular_x[CAL_LEN];
+  static float        y[CAL_LEN];
+  static interp_seg_t uni_segs[CAL_LEN - 1];
+  static interp_seg_t irr_segs[CAL_LEN - 1];
+  static float        xu[BATCH_LEN];
+  static float        xi[BATCH_LEN];
+  static float        out[BATCH_LEN];
+  interp_table_t      uni = { 0 };
+  interp_table_t      irr = { 0 };
+
+  for (int i = 0; i < CAL_LEN; ++i) {
+    uniform_x[i]   = -5.0f + (0.25f * (float)i);
+    irregular_x[i] = (float)i + ((float)(i * i) / 100.0f);
+    y[i]           = (float)((i * 37) % 101) - 50.0f;
+  }
+  interpolated_table_init(&uni, uni_segs, uniform_x, y, CAL_LEN);
+  interpolated_table_init(&irr, irr_segs, irregular_x, y, CAL_LEN);
+
+  // Out of both ends (saturation), breakpoints (LUT hits) and values within the segments
+  for (int i = 0; i < BATCH_LEN; ++i) {
+    xu[i] = (0 == (i % 5)) ? uniform_x[(i * 7) % CAL_LEN] : -10.0f + (0.2513f * (float)i);
+    xi[i] = (0 == (i % 5)) ? irregular_x[(i * 7) % CAL_LEN] : -50.0f + (float)(i * i) / 90.0f;
+  }
+  // NaN lanes, the first 12 inputs are an AVX2 block then a SSE2 one, the last ones the scalar tail
+  xu[3] = xu[9] = xu[BATCH_LEN - 1] = NAN;
+  xi[5] = xi[10] = xi[BATCH_LEN - 2] = -NAN;
+
+  int mismatches = 0;
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_estimate_n(xu, out, BATCH_LEN, &uni), "Uniform batch");
+  for (int i = 0; i < BATCH_LEN; ++i) {
+    if (out[i] != interpolated_table_estimate(xu[i], &uni)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_estimate_n(xi, out, BATCH_LEN, &irr), "Irregular batch");
+  for (int i = 0; i < BATCH_LEN; ++i) {
+    if (out[i] != interpolated_table_estimate(xi[i], &irr)) ++mismatches;
+  }
+  for (int n = 4; n <= 12; n += 4) {
+    interpolated_estimate_n(xu, out, n, &uni);
+    for (int i = 0; i < n; ++i) {
+      if (out[i] != interpolated_table_estimate(xu[i], &uni)) ++mismatches;
+    }
+    interpolated_estimate_n(xi, out, n, &irr);
+    for (int i = 0; i < n; ++i) {
+      if (out[i] != interpolated_table_estimate(xi[i], &irr)) ++mismatches;
+    }
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Batch shall match the scalar estimation");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, out[10], "NaN lane");
+
+  // In place on the steering table
+  const float a_data[]        = { -22, -11, 0, 10, 20 };
+  const float v_data[]        = { -1.5, -1, 0, 1.2, 1.8 };
+  float       v[11]           = { -30, -22, -16.5, -11, -5, 0, 5, 10, 15, 20, 35 };
+  const float v_expected[11]  = { -1.5, -1.5, -1.25, -1, -0.454545f, 0, 0.6, 1.2, 1.5, 1.8, 1.8 };
+
+  INTERP_TABLE_BUILD(steering_lut, a_data, v_data);
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_estimate_n(v, v, 11, &steering_lut), "Steering batch");
+  for (int i = 0; i < 11; ++i) {
+    TEST_ASSERT_EQUAL_FLOAT_MSG(v_expected[i], v[i], "Steering batch values");
+  }
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_estimate_n(xu, out, 0, &uni), "Empty batch");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_estimate_n(NULL, out, 8, &uni), "Batch input error");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_estimate_n(xu, NULL, 8, &uni), "Batch output error");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_estimate_n(xu, out, 8, NULL), "Batch table error");
+}
+
+void cursor_table_test(void) {
+  static float        irregular_x[CAL_LEN];
+  static float        y[CAL_LEN];
+  static interp_seg_t irr_segs[CAL_LEN - 1];
+  interp_table_t      irr    = { 0 };
+  interp_cursor_t     cursor = { 0 };
+
+  for (int i = 0; i < CAL_LEN; ++i) {
+    irregular_x[i] = (float)i + ((float)(i * i) / 100.0f);
+    y[i]           = (float)((i * 37) % 101) - 50.0f;
+  }
+  interpolated_table_init(&irr, irr_segs, irregular_x, y, CAL_LEN);
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_cursor_init(&cursor, NULL), "Cursor table error");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, interpolated_cursor_estimate(5.0f, &cursor), "Cursor not initialized");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_cursor_init(&cursor, &irr), "Cursor init");
+
+  int   mismatches = 0;
+  float x          = -10.0f;
+  // Slowly varying signal forward and backward, then jumps of any distance (gallop)
+  for (int i = 0; i < 8000; ++i) {
+    x = (i < 4000) ? (-10.0f + (float)i * 3.0f) : (12010.0f - (float)(i - 4000) * 3.0f);
+    if (interpolated_cursor_estimate(x, &cursor) != interpolated_table_estimate(x, &irr)) ++mismatches;
+  }
+  for (int i = 0; i < 2000; ++i) {
+    x = (float)((i * 7919) % 10900) + 0.5f;
+    if (interpolated_cursor_estimate(x, &cursor) != interpolated_table_estimate(x, &irr)) ++mismatches;
+    if ((irregular_x[cursor.seg] > x) || (x >= irregular_x[cursor.seg + 1])) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Cursor shall match the table estimation");
+
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[0], interpolated_cursor_estimate(-1.0f, &cursor), "Cursor saturated low");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[CAL_LEN - 1], interpolated_cursor_estimate(2e4f, &cursor), "Saturated high");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[321], interpolated_cursor_estimate(irregular_x[321], &cursor), "Cursor hit");
+  TEST_ASSERT_EQUAL_VAL_MSG(321, cursor.seg, "Cursor on the last segment found");
+  x = interpolated_table_estimate(NAN, &irr);
+  TEST_ASSERT_EQUAL_FLOAT_MSG(x, interpolated_cursor_estimate(NAN, &cursor), "Cursor NaN as the table");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, interpolated_cursor_estimate(-NAN, &cursor), "Cursor NaN");
+  TEST_ASSERT_EQUAL_VAL_MSG(321, cursor.seg, "Cursor kept on a NaN");
+}
+
+#define Q_LEN (64)
+
+INTERP_Q15_TABLE_CREATE(adc_lut, Q_LEN);
+
+void fixed_q15_table_test(void) {
+  static int16_t adc_x[Q_LEN];
+  static int16_t adc_y[Q_LEN];
+  static float   fx[Q_LEN];
+  static float   fy[Q_LEN];
+  static int16_t in[1 << 16];
+  static int16_t out[1 << 16];
+
+  // Irregular domain over the whole Q15 range, flat, steep and full scale segments
+  for (int i = 0; i < Q_LEN; ++i) {
+    adc_x[i] = (int16_t)(-32768 + ((i * i * 65535) / ((Q_LEN - 1) * (Q_LEN - 1))));
+    adc_y[i] = (int16_t)((0 == (i % 7)) ? 32767 : ((1 == (i % 7)) ? -32768 : (((i * 9973) % 20001) - 10000)));
+    fx[i]    = (float)adc_x[i];
+    fy[i]    = (float)adc_y[i];
+  }
+  adc_y[11] = adc_y[10]; // Flat segment
+  fy[11]    = fy[10];
+
+  const int16_t x_unsort[] = { 0, -1, 2 };
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_q15_table_init(&adc_lut, adc_lut_segs, x_unsort, adc_y, 3),
+                            "Q15 unsorted domain");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, INTERP_Q15_TABLE_BUILD(adc_lut, NULL, adc_y), "Q15 data error");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, interpolated_q15_estimate(5, &adc_lut), "Q15 table not built");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, INTERP_Q15_TABLE_BUILD(adc_lut, adc_x, adc_y), "Q15 table");
+
+  // Every Q15 input against the float implementation
+  int worst = 0;
+  for (int i = 0; i < (1 << 16); ++i) {
+    int16_t const x   = (int16_t)(i - 32768);
+    float const   f   = interpolated_estimate((float)x, fx, fy, Q_LEN);
+    float const   err = (float)interpolated_q15_estimate(x, &adc_lut) - f;
+
+    if ((err > 1.0f) || (err < -1.0f)) ++worst;
+    in[i] = (int16_t)((i * 37) % 4096) + x / 2; // Slowly varying with jumps
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, worst, "Q15 shall be within 1 LSB of the float estimation");
+
+  int mismatches = 0;
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_q15_estimate_n(in, out, 1 << 16, &adc_lut), "Q15 batch");
+  for (int i = 0; i < (1 << 16); ++i) {
+    if (out[i] != interpolated_q15_estimate(in[i], &adc_lut)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Q15 batch shall match the estimation");
+
+  TEST_ASSERT_EQUAL_VAL_MSG(adc_y[0], interpolated_q15_estimate(-32768, &adc_lut), "Q15 saturated low");
+  TEST_ASSERT_EQUAL_VAL_MSG(adc_y[9], interpolated_q15_estimate(adc_x[9], &adc_lut), "Q15 LUT hit");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_q15_estimate_n(in, out, 8, NULL), "Q15 batch error");
+}
+
+void fixed_q31_table_test(void) {
+  static int32_t       x[Q_LEN];
+  static int32_t       y[Q_LEN];
+  static int32_t       in[4096];
+  static int32_t       out[4096];
+  static interp_qseg_t segs[Q_LEN - 1];
+  interp_q31_table_t   q31 = { 0 };
+
+  for (int i = 0; i < Q_LEN; ++i) {
+    x[i]  = (int32_t)(-2147483647 - 1 + (int64_t)i * i * 1082000);
+    y[i]  = (0 == (i % 5)) ? 2147483647 : ((1 == (i % 5)) ? (-2147483647 - 1) : (i * 104729 - 3000000));
+  }
+  x[1] = x[0] + 1; // Full scale step in a single LSB
+  x[2] = x[0] + 3;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_q31_table_init(&q31, segs, x, y, Q_LEN), "Q31 table");
+
+  int worst = 0;
+  for (int i = 0; i < 4096; ++i) {
+    int32_t const xi = (int32_t)(-2147483647 - 1 + (int64_t)i * 1048575);
+    int32_t const qi = interpolated_q31_estimate(xi, &q31);
+    int           s  = 0;
+
+    while ((s < Q_LEN - 2) && (x[s + 1] <= xi)) ++s;
+    // Exact interpolation on double, the float estimation can't resolve Q31 (24 bits mantissa)
+    double const exact = (double)y[s] + ((double)y[s + 1] - (double)y[s]) * ((double)xi - (double)x[s]) /
+                                            ((double)x[s + 1] - (double)x[s]);
+    double const err = (double)qi - ((xi >= x[Q_LEN - 1]) ? (double)y[Q_LEN - 1] : exact);
+
+    if ((err > 3.0) || (err < -3.0)) ++worst;
+    in[i] = xi;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, worst, "Q31 shall be within 3 LSB of the exact interpolation");
+
+  int mismatches = 0;
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_q31_estimate_n(in, out, 4096, &q31), "Q31 batch");
+  for (int i = 0; i < 4096; ++i) {
+    if (out[i] != interpolated_q31_estimate(in[i], &q31)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Q31 batch shall match the estimation");
+  TEST_ASSERT_EQUAL_VAL_MSG(y[1], interpolated_q31_estimate(x[1], &q31), "Q31 LUT hit");
+  TEST_ASSERT_EQUAL_VAL_MSG(y[Q_LEN - 1], interpolated_q31_estimate(2147483647, &q31), "Q31 saturated high");
+}
+
+#define BANK_LEN (6)
+#define BANK_CNT (13) // Not a multiple of the vector width, so all the kernels and the tail are used
+
+INTERP_BANK_CREATE(angle_bank, BANK_LEN, BANK_CNT);
+
+void bank_table_test(void) {
+  const float         x[BANK_LEN] = { -22, -11, 0, 10, 20, 40 };
+  static float        y[BANK_CNT][BANK_LEN];
+  static interp_seg_t segs[BANK_CNT][BANK_LEN - 1];
+  interp_table_t      tables[BANK_CNT];
+  const float        *ranges[BANK_CNT];
+  float               out[BANK_CNT];
+
+  for (int t = 0; t < BANK_CNT; ++t) {
+    for (int i = 0; i < BANK_LEN; ++i) {
+      y[t][i] = (float)(((t + 3) * (i + 7) * 31) % 97) * 0.1f - 4.0f;
+    }
+    ranges[t] = y[t];
+    interpolated_table_init(&tables[t], segs[t], x, y[t], BANK_LEN);
+  }
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_bank_estimate(1.0f, &angle_bank, out), "Bank not built");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, INTERP_BANK_BUILD(angle_bank, x, ranges), "Bank");
+  TEST_ASSERT_EQUAL_VAL_MSG(BANK_CNT, angle_bank.count, "Tables from the bank storage");
+  TEST_ASSERT_EQUAL_VAL_MSG(BANK_LEN, angle_bank.length, "Length from the bank storage");
+
+  // Every table of the bank against its own table object: interpolation, LUT hits and saturation
+  int mismatches = 0;
+  for (int i = -100; i <= 500; ++i) {
+    float const xi = (0 == (i % 50)) ? x[(i / 50 + 2) % BANK_LEN] : (0.1f * (float)i) - 5.0f;
+
+    interpolated_bank_estimate(xi, &angle_bank, out);
+    for (int t = 0; t < BANK_CNT; ++t) {
+      if (out[t] != interpolated_table_estimate(xi, &tables[t])) ++mismatches;
+    }
+  }
+  interpolated_bank_estimate(NAN, &angle_bank, out);
+  for (int t = 0; t < BANK_CNT; ++t) {
+    if (out[t] != interpolated_table_estimate(NAN, &tables[t])) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Bank shall match the table estimations");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_bank_estimate(1.0f, &angle_bank, NULL), "Bank output error");
+}
+
+INTERP_RESAMPLED_CREATE(fast_lut, 512);
+
+void resample_table_test(void) {
+  const float              x[]    = { -22, -11, 0, 10, 20, 21.3f, 23, 40 }; // Irregular
+  const float              y[]    = { -1.5, -1, 0, 1.2, 1.8, 2.9f, 3, 2.5f };
+  interp_resample_report_t report = { 0 };
+  interp_resample_report_t coarse = { 0 };
+  interp_table_t           small  = { 0 };
+  float                    sd[16];
+  float                    sr[16];
+  interp_seg_t             ss[15];
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, INTERP_RESAMPLE_BUILD(fast_lut, x, NULL, 8, 0.01f, &report),
+                            "Resample data error");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, INTERP_RESAMPLE_BUILD(fast_lut, x, y, 8, 0.01f, &report), "Resampled table");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, 0.0f != fast_lut.inv_step, "Resampled table shall be uniform");
+  TEST_ASSERT_EQUAL_VAL_MSG(report.length, fast_lut.length, "Report length");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, report.max_err <= 0.01f, "Report error");
+  TEST_ASSERT_EQUAL_VAL_MSG((uint32_t)((report.length * 16) - 8), report.bytes, "Report memory cost");
+
+  // Dense sweep, saturation included
+  int violations = 0;
+  for (int i = 0; i <= 8000; ++i) {
+    float const xi  = -30.0f + (0.01f * (float)i);
+    float const err = interpolated_table_estimate(xi, &fast_lut) - interpolated_estimate(xi, x, y, 8);
+
+    if ((err > 0.01f) || (err < -0.01f)) ++violations;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, violations, "Resampled error shall be bounded");
+
+  // A looser bound needs a smaller grid, a bound out of the capacity is reported
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, INTERP_RESAMPLE_BUILD(fast_lut, x, y, 8, 0.1f, &coarse), "Coarse table");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, coarse.length < report.length, "Coarse grid shall be smaller");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_resample(&small, sd, sr, ss, 16, x, y, 8, 1e-4f, &report),
+                            "Bound out of the capacity");
+  TEST_ASSERT_EQUAL_VAL_MSG(16, report.length, "Largest grid");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, report.max_err > 1e-4f, "Error of the largest grid");
+}
+
+#define SPL_LEN (9)
+
+/* Taylor series of sin(x), accurate to 1e-7 on [0, pi] */
+static float sine(float x) {
+  float term = x;
+  float sum  = x;
+  for (int k = 1; k < 10; ++k) {
+    term *= -(x * x) / (float)((2 * k) * ((2 * k) + 1));
+    sum += term;
+  }
+  return sum;
+}
+
+INTERP_SPLINE_CREATE(sine_spline, SPL_LEN);
+
+void spline_table_test(void) {
+  float           x[SPL_LEN];
+  float           y[SPL_LEN];
+  interp_seg_t    segs[SPL_LEN - 1];
+  interp_cubic_t  cubics[SPL_LEN - 1];
+  interp_table_t  lin   = { 0 };
+  interp_spline_t pchip = { 0 };
+
+  for (int i = 0; i < SPL_LEN; ++i) {
+    x[i] = 0.4f * (float)i;
+    y[i] = sine(x[i]);
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, INTERP_SPLINE_BUILD(sine_spline, x, NULL, INTERP_SPLINE_PCHIP),
+                            "Spline data error");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, interpolated_spline_estimate(1.0f, &sine_spline), "Spline not built");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, INTERP_SPLINE_BUILD(sine_spline, x, y, INTERP_SPLINE_NATURAL), "Natural");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, 0.0f != sine_spline.inv_step, "Uniform spacing shall be detected");
+  interpolated_table_init(&lin, segs, x, y, SPL_LEN);
+  interpolated_spline_init(&pchip, cubics, x, y, SPL_LEN, INTERP_SPLINE_PCHIP);
+
+  // Same samples, the cubic error is several times smaller than the linear one (h^4 vs h^2)
+  float err_nat = 0.0f;
+  float err_pch = 0.0f;
+  float err_lin = 0.0f;
+  for (int i = 0; i <= 320; ++i) {
+    float const xi = 0.01f * (float)i;
+    float const en = interpolated_spline_estimate(xi, &sine_spline) - sine(xi);
+    float const ep = interpolated_spline_estimate(xi, &pchip) - sine(xi);
+    float const el = interpolated_table_estimate(xi, &lin) - sine(xi);
+
+    err_nat = ((en > err_nat) || (-en > err_nat)) ? ((en > 0.0f) ? en : -en) : err_nat;
+    err_pch = ((ep > err_pch) || (-ep > err_pch)) ? ((ep > 0.0f) ? ep : -ep) : err_pch;
+    err_lin = ((el > err_lin) || (-el > err_lin)) ? ((el > 0.0f) ? el : -el) : err_lin;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(true, (10.0f * err_nat) < err_lin, "Natural spline error shall be 10x smaller");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, err_pch < err_lin, "PCHIP error shall be smaller");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[3], interpolated_spline_estimate(x[3], &sine_spline), "Spline LUT hit");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[0], interpolated_spline_estimate(-1.0f, &sine_spline), "Saturated low");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(y[SPL_LEN - 1], interpolated_spline_estimate(9.0f, &sine_spline), "Saturated");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, interpolated_spline_estimate(NAN, &sine_spline), "Spline NaN input");
+
+  // Step data: the natural spline overshoots, the PCHIP is monotone and bounded by the samples
+  const float     sx[6] = { 0, 1, 2, 3, 4.5, 5 }; // Irregular
+  const float     sy[6] = { 0, 0, 0, 1, 1, 1 };
+  interp_spline_t step  = { 0 };
+  float           in[200];
+  float           out[200];
+  int             violations = 0;
+  float           min_nat    = 0.0f;
+
+  interpolated_spline_init(&step, cubics, sx, sy, 6, INTERP_SPLINE_NATURAL);
+  for (int i = 0; i < 200; ++i) {
+    in[i]         = (float)(i % 100) * 0.05f + ((i < 100) ? 0.0f : 0.025f);
+    float const v = interpolated_spline_estimate(in[i], &step);
+    min_nat       = (v < min_nat) ? v : min_nat;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(true, min_nat < 0.0f, "Natural spline overshoots on a step");
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_spline_init(&step, cubics, sx, sy, 6, INTERP_SPLINE_PCHIP),
+                            "Step PCHIP");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_spline_estimate_n(in, out, 200, &step), "Spline batch");
+  for (int i = 0; i < 200; ++i) {
+    if ((out[i] < 0.0f) || (out[i] > 1.0f)) ++violations;
+    if ((0 < (i % 100)) && (out[i] < out[i - 1])) ++violations;
+    if (out[i] != interpolated_spline_estimate(in[i], &step)) ++violations;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, violations, "PCHIP shall be monotone and match the batch");
+}
+
+/* Voltage map as a function of the angle and the speed, V = f(a, s) */
+void steering_map_test(void) {
+  const float  a_data[]     = { -22, -11, 0, 10, 20 }; // Angle
+  const float  s_data[]     = { 0, 50, 100 };          // Speed
+  const float *axes[]       = { a_data, s_data };
+  const int    lengths[]    = { 5, 3 };
+  const float  v_data[5][3] = {
+    { -1.5, -1.8, -2.4 }, { -1, -1.2, -1.6 }, { 0, 0, 0 }, { 1.2, 1.4, 2 }, { 1.8, 2.2, 3 },
+  };
+  interp_map_t        map    = { 0 };
+  interp_map_cursor_t cursor = { 0 };
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_map_init(&map, axes, lengths, 0, &v_data[0][0]), "No dims");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, interpolated_map_init(&map, axes, lengths, 2, NULL), "Map data error");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, interpolated_map_estimate(s_data, &map), "Map not built");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_map_init(&map, axes, lengths, 2, &v_data[0][0]), "Steering map");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_map_cursor_init(&cursor, &map), "Map cursor");
+
+  const float points[][2] = { { 10, 50 }, { 5, 0 }, { 15, 75 }, { -30, 25 }, { 35, 200 }, { -16.5, 50 } };
+  const float expected[]  = { 1.4f, 0.6f, 2.15f, -1.65f, 3.0f, -1.5f };
+  float       out[6]      = { 0 };
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_map_estimate_n(&points[0][0], out, 6, &map), "Map batch");
+  for (int i = 0; i < 6; ++i) {
+    TEST_ASSERT_EQUAL_FLOAT_MSG(expected[i], interpolated_map_estimate(points[i], &map), "Bilinear");
+    TEST_ASSERT_EQUAL_FLOAT_MSG(expected[i], interpolated_map_cursor_estimate(points[i], &cursor), "Cursor");
+    TEST_ASSERT_EQUAL_FLOAT_MSG(expected[i], out[i], "Map batch values");
+  }
+}
+
+#define MAP_LEN (9)
+
+void multilinear_map_test(void) {
+  static float values[MAP_LEN * MAP_LEN * MAP_LEN * MAP_LEN];
+  static float inputs[500][4];
+  static float out[500];
+  float        axis[4][MAP_LEN];
+  const float *axes[4]    = { axis[0], axis[1], axis[2], axis[3] };
+  const float *axes3[3]   = { axis[1], axis[2], axis[3] };
+  const int    lengths[4] = { MAP_LEN, MAP_LEN, MAP_LEN, MAP_LEN };
+  interp_map_t map3       = { 0 };
+  interp_map_t map4       = { 0 };
+
+  // Irregular axes, f = 1 + 2x - 3y + 0.5z + w is reproduced exactly by a multilinear interpolation
+  for (int d = 0; d < 4; ++d) {
+    for (int i = 0; i < MAP_LEN; ++i) {
+      axis[d][i] = (float)(i * (i + d + 1)) - 10.0f;
+    }
+  }
+  for (int i = 0; i < MAP_LEN * MAP_LEN * MAP_LEN * MAP_LEN; ++i) {
+    int const i0 = i / (MAP_LEN * MAP_LEN * MAP_LEN);
+    int const i1 = (i / (MAP_LEN * MAP_LEN)) % MAP_LEN;
+    int const i2 = (i / MAP_LEN) % MAP_LEN;
+    int const i3 = i % MAP_LEN;
+
+    values[i] = 1.0f + (2.0f * axis[0][i0]) - (3.0f * axis[1][i1]) + (0.5f * axis[2][i2]) + axis[3][i3];
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_map_init(&map4, axes, lengths, 4, values), "4D map");
+  // The first MAP_LEN^3 values are the 3D map f(y, z, w) with x = axis[0][0] = -10
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_map_init(&map3, axes3, lengths, 3, values), "3D map");
+
+  int mismatches = 0;
+  for (int i = 0; i < 500; ++i) {
+    for (int d = 0; d < 4; ++d) {
+      inputs[i][d] = -5.0f + (float)((i * (d + 3) * 7) % 72) * 0.9f; // Slowly varying with jumps
+    }
+    float const x     = inputs[i][0];
+    float const y     = inputs[i][1];
+    float const z     = inputs[i][2];
+    float const w     = inputs[i][3];
+    float const f3    = 1.0f - 20.0f - (3.0f * x) + (0.5f * y) + z;
+    float const f4    = 1.0f + (2.0f * x) - (3.0f * y) + (0.5f * z) + w;
+    float const diff3 = interpolated_map_estimate(inputs[i], &map3) - f3;
+    float const diff4 = interpolated_map_estimate(inputs[i], &map4) - f4;
+
+    if ((diff3 > 1e-3f) || (diff3 < -1e-3f) || (diff4 > 1e-3f) || (diff4 < -1e-3f)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Trilinear and multilinear interpolation");
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, interpolated_map_estimate_n(&inputs[0][0], out, 500, &map4), "4D batch");
+  for (int i = 0; i < 500; ++i) {
+    if (out[i] != interpolated_map_estimate(inputs[i], &map4)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Map batch shall match the estimation");
 }
 
 int main(void) {
@@ -166,6 +712,17 @@ int main(void) {
   uTEST_ADD_MSG(steering_test_interpolation, "Steering Problem testing values within the table and saturated",
                 64);
   uTEST_ADD_MSG(steering_test_interpolation_with_errors, "Steering Problem testing error handling", 129);
+  uTEST_ADD_MSG(calibration_table_test, "Calibration tables with uniform and irregular domains");
+  uTEST_ADD_MSG(steering_table_test, "Steering Problem through a precomputed table object");
+  uTEST_ADD_MSG(batch_table_test, "Batch estimation shall match the scalar one");
+  uTEST_ADD_MSG(cursor_table_test, "Cursor estimation of slowly varying and jumping inputs");
+  uTEST_ADD_MSG(fixed_q15_table_test, "Q15 tables against the float estimation");
+  uTEST_ADD_MSG(fixed_q31_table_test, "Q31 tables against the exact interpolation");
+  uTEST_ADD_MSG(bank_table_test, "Bank of tables sharing a domain against the table objects");
+  uTEST_ADD_MSG(resample_table_test, "Uniform resampling of an irregular table with a bounded error");
+  uTEST_ADD_MSG(spline_table_test, "Natural cubic spline and monotone PCHIP tables");
+  uTEST_ADD_MSG(steering_map_test, "Steering Problem as a function of the angle and the speed");
+  uTEST_ADD_MSG(multilinear_map_test, "Trilinear and 4D maps of a multilinear function");
 
   return (uTEST_END());
 }
\ No newline at end of file
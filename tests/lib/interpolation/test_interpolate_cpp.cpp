@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C-UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_interpolate_cpp.cpp
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for test the compile-time interpolation table (c_utils::Interp)
+ *
+ */
+
+#include "interpolate.h"
+#include "interpolation/interpolate.hpp"
+#include "uTest.h"
+
+// Steering Problem at compile time, V = f(a)
+constexpr float a_data[] = { -22, -11, 0, 10, 20 };
+constexpr float v_data[] = { -1.5, -1, 0, 1.2, 1.8 };
+
+constexpr c_utils::Interp<5> steering(a_data, v_data);
+
+static_assert(steering.valid(), "Strictly increasing domain");
+static_assert(1.2f == steering(10.0f), "Angle in table (LUT), folded");
+static_assert(-1.5f == steering(-30.0f), "Saturated low, folded");
+static_assert(1.8f == steering(35.0f), "Saturated high, folded");
+static_assert((steering(15.0f) > 1.4999f) && (steering(15.0f) < 1.5001f), "Interpolation, folded");
+
+// Fails to compile: constexpr c_utils::Interp<3> bad({ 0.f, 2.f, 1.f }, { 0.f, 1.f, 2.f });
+constexpr float bad_x[] = { 0, 2, 2 };
+
+void interp_constexpr_test(void) {
+  float inputs[]   = { -30, -22, -16.5, -11, -5, 0, 5, 10, 15, 20, 35 };
+  int   mismatches = 0;
+
+  // Same results as the C estimation with runtime inputs
+  for (float x : inputs) {
+    if (steering(x) != interpolated_estimate(x, a_data, v_data, 5)) ++mismatches;
+  }
+  for (int i = -250; i <= 250; ++i) {
+    float const x = 0.1f * (float)i;
+    if (steering.estimate(x) != interpolated_estimate(x, a_data, v_data, 5)) ++mismatches;
+  }
+  if (steering(NAN) != interpolated_estimate(NAN, a_data, v_data, 5)) ++mismatches;
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Interp shall match the C estimation");
+
+  // Runtime built table with an invalid domain
+  c_utils::Interp<3> bad(bad_x, { 0.f, 1.f, 2.f });
+  TEST_ASSERT_EQUAL_VAL_MSG(false, bad.valid(), "Repeated sample");
+  TEST_ASSERT_EQUAL_FLOAT_MSG(0.0f, bad(1.0f), "Invalid table");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(interp_constexpr_test, "Compile-time table against the C estimation");
+
+  return (uTEST_END());
+}
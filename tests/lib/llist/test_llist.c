@@ -172,6 +172,146 @@ void test_llist_errors_and_delete() {
   TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, llist_reversal(&head), "Reversing empty list shall fail");
 }
 
+typedef struct visit_ctx {
+  uint32_t sum;
+  uint32_t visited;
+  uint32_t stop_at;
+} visit_ctx_t;
+
+static base_t sum_until(void *data, void *ctx) {
+  visit_ctx_t *v = (visit_ctx_t *)ctx;
+
+  ++v->visited;
+  v->sum += ((my_struct_t *)data)->data;
+
+  return (v->stop_at == ((my_struct_t *)data)->data) ? NOT_OK : OK;
+}
+
+void test_llist_traverse_ctx() {
+  my_struct_t obj  = { 0 };
+  ll_handle_t head = NULL;
+
+  for (uint32_t i = 0; i < MAX_LLIST_LEN; ++i) {
+    obj.data = i + 1;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_push_head(&head, llist_create_node(&obj, sizeof(my_struct_t))),
+                              "Failed to push head");
+  }
+  visit_ctx_t all = { 0, 0, 0 };
+  TEST_ASSERT_EQUAL_MSG(NULL, llist_traverse_ctx(head, sum_until, &all), "Whole list shall be visited");
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN, all.visited, "No NULL notification at the end");
+  TEST_ASSERT_EQUAL_VAL_MSG((MAX_LLIST_LEN * (MAX_LLIST_LEN + 1)) / 2, all.sum, "Sum of the list");
+
+  // The head holds MAX_LLIST_LEN, stop on the 4th node
+  visit_ctx_t   early = { 0, 0, MAX_LLIST_LEN - 3 };
+  ll_node_ptr_t stop  = llist_traverse_ctx(head, sum_until, &early);
+  TEST_ASSERT_EQUAL_VAL_MSG(4, early.visited, "Traversal shall stop when the visitor returns NOT_OK");
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN - 3, ((my_struct_t *)stop->data)->data, "Node where it stopped");
+
+  TEST_ASSERT_EQUAL_MSG(NULL, llist_traverse_ctx(NULL, sum_until, &all), "Empty list");
+  llist_delete_list(&head);
+}
+
+void test_llist_compact() {
+  my_struct_t obj   = { 0 };
+  ll_handle_t head  = NULL;
+  ll_block_t  block = { 0 };
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, llist_compact(&head, sizeof(my_struct_t), &block), "Empty list");
+
+  for (uint32_t i = 0; i < MAX_LLIST_LEN; ++i) {
+    obj.data = i + 1;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_push_head(&head, llist_create_node(&obj, sizeof(my_struct_t))),
+                              "Failed to push head");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_compact(&head, sizeof(my_struct_t), &block), "Failed to compact");
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN, llist_get_size(head), "Compacted list keeps its size");
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN, block.count, "Block holds every node");
+  TEST_ASSERT_EQUAL_MSG(block.nodes, head, "Head is the first node of the block");
+
+  ll_node_ptr_t node = head;
+  for (uint32_t i = 0; i < MAX_LLIST_LEN; ++i) {
+    TEST_ASSERT_EQUAL_MSG(&block.nodes[i], node, "Nodes are contiguous in traversal order");
+    TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN - i, ((my_struct_t *)node->data)->data, "Order is kept");
+    TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN - i, LLIST_BLOCK_DATA(my_struct_t, block)[i].data, "Array view");
+    node = node->next;
+  }
+
+  visit_ctx_t all = { 0, 0, 0 };
+  TEST_ASSERT_EQUAL_MSG(NULL, llist_traverse_ctx(head, sum_until, &all), "Whole list shall be visited");
+  TEST_ASSERT_EQUAL_VAL_MSG((MAX_LLIST_LEN * (MAX_LLIST_LEN + 1)) / 2, all.sum, "Sum of the list");
+
+  // Nodes pushed after the compaction are released along with the block
+  obj.data = 0;
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_push_head(&head, llist_create_node(&obj, sizeof(my_struct_t))),
+                            "Failed to push head");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_reversal(&head), "Failed to reverse list");
+  llist_delete_compact(&head, &block);
+  TEST_ASSERT_EQUAL_MSG(NULL, head, "Head shall be NULL");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, block.count, "Block shall be cleared");
+}
+
+static base_t below(void *data, void *ctx) {
+  return (((my_struct_t *)data)->data < *(uint32_t *)ctx) ? OK : NOT_OK;
+}
+
+static void push_tail_range(ll_handle_t *head, uint32_t from, uint32_t to) {
+  my_struct_t obj = { 0 };
+
+  for (uint32_t i = from; i <= to; ++i) {
+    obj.data = i;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_push_tail(head, llist_create_node(&obj, sizeof(my_struct_t))),
+                              "Failed to push tail");
+  }
+}
+
+void test_llist_splice_concat_split() {
+  ll_handle_t head  = NULL;
+  ll_handle_t other = NULL;
+  ll_handle_t rest  = NULL;
+  uint32_t    limit = 8;
+
+  push_tail_range(&head, 1, 5);
+  push_tail_range(&other, 6, MAX_LLIST_LEN);
+  void *first_data = other->data;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_concat(&head, &other), "Failed to concat");
+  TEST_ASSERT_EQUAL_MSG(NULL, other, "Source list shall be empty");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, llist_concat(&head, &other), "Nothing to concat");
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN, llist_get_size(head), "All the nodes moved");
+  ll_node_ptr_t sixth = head->next->next->next->next->next;
+  TEST_ASSERT_EQUAL_MSG(first_data, sixth->data, "Data is not reallocated");
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN, ((my_struct_t *)llist_get_tail(head)->data)->data, "Tail");
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_split_at(&head, 3, &rest), "Failed to split at position");
+  TEST_ASSERT_EQUAL_VAL_MSG(3, llist_get_size(head), "First part");
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_LLIST_LEN - 3, llist_get_size(rest), "Second part");
+  TEST_ASSERT_EQUAL_VAL_MSG(4, ((my_struct_t *)rest->data)->data, "Second part starts at position 3");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, llist_split_at(&head, 1, &rest), "Rest shall be empty");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, llist_split_at(&head, 3, &other), "Position out of the list");
+
+  // O(1) concat with a known tail
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_splice(&llist_get_tail(head)->next, &rest, llist_get_tail(rest)),
+                            "Failed to splice");
+  TEST_ASSERT_EQUAL_MSG(NULL, rest, "Source list shall be empty");
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_split_if(&head, below, &limit, &rest), "Failed to split if");
+  TEST_ASSERT_EQUAL_VAL_MSG(limit - 1, llist_get_size(head), "Nodes below the limit");
+  TEST_ASSERT_EQUAL_VAL_MSG(limit, ((my_struct_t *)rest->data)->data, "Split before the first failing node");
+
+  // Move the range {9, 10} in front of the list
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, llist_splice(&head, &rest->next, rest->next->next), "Failed to splice range");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, llist_get_size(rest), "Only 8 left");
+  TEST_ASSERT_EQUAL_VAL_MSG(9, ((my_struct_t *)head->data)->data, "Range at the head");
+  TEST_ASSERT_EQUAL_VAL_MSG(10, ((my_struct_t *)head->next->data)->data, "Range at the head");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, ((my_struct_t *)head->next->next->data)->data, "Followed by the old head");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, llist_splice(&head, &other, head), "Empty source");
+
+  limit = 0;
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, llist_split_if(&other, below, &limit, &head), "Rest shall be empty");
+  llist_delete_list(&head);
+  llist_delete_list(&rest);
+}
+
 int main() {
   uTEST_INIT("test_llist.c");
   uTEST_ADD_MSG(test_llist_no_macros, "Linked list test with no macros");
@@ -179,5 +319,8 @@ int main() {
   uTEST_ADD_MSG(test_llist_with_macros,
                 "List test with macros, no need to freed memory or declare the handle");
   uTEST_ADD_MSG(test_llist_errors_and_delete, "Linked list testing errors and delete");
+  uTEST_ADD_MSG(test_llist_traverse_ctx, "Linked list traversal with context and early exit");
+  uTEST_ADD_MSG(test_llist_compact, "Linked list compacted into a single block");
+  uTEST_ADD_MSG(test_llist_splice_concat_split, "Linked list moving nodes with splice, concat and split");
   return (uTEST_END());
 }
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C-UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_pool.cpp
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for test the work-stealing deque and the Thread Pool library
+ *
+ */
+
+#include "interpolate.h"
+#include "pool/thread_pool.hpp"
+#include "pool/ws_deque.hpp"
+#include "uTest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define STEAL_ITEMS   (200000)
+#define STEAL_THIEVES (3)
+#define POOL_WORKERS  (4)
+#define BATCH_LEN     (1 << 20)
+#define BATCH_BLOCK   (4096)
+
+INTERP_TABLE_CREATE(steering_lut, 5);
+
+void ws_deque_test(void) {
+  c_utils::WsDeque<int, 4> deque;
+  int                      value = 0;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, deque.empty(), "New deque empty");
+  for (int i = 1; i <= 4; ++i) deque.push(i);
+  TEST_ASSERT_EQUAL_VAL_MSG(false, deque.push(5), "Push on full deque");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, deque.pop(value), "Owner pop");
+  TEST_ASSERT_EQUAL_VAL_MSG(4, value, "Owner takes the newest");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, deque.steal(value), "Steal");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, value, "Thief takes the oldest");
+  TEST_ASSERT_EQUAL_VAL_MSG(2, deque.size(), "Size after pop and steal");
+  deque.pop(value);
+  deque.pop(value);
+  TEST_ASSERT_EQUAL_VAL_MSG(2, value, "Owner takes the last element");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, deque.pop(value), "Pop on empty deque");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, deque.steal(value), "Steal on empty deque");
+
+  // The owner pushes and pops while the thieves steal, every item shall be taken exactly once
+  static c_utils::WsDeque<int, 256> shared;
+  static std::atomic<int>           taken[STEAL_ITEMS];
+  std::atomic<bool>                 done{ false };
+  std::vector<std::thread>          thieves;
+
+  for (int t = 0; t < STEAL_THIEVES; ++t) {
+    thieves.emplace_back([&done]() {
+      int item = 0;
+      while (!done.load()) {
+        if (shared.steal(item)) ++taken[item];
+      }
+    });
+  }
+  for (int i = 0; i < STEAL_ITEMS; ++i) {
+    while (!shared.push(i)) {
+      if (shared.pop(value)) ++taken[value];
+    }
+    if ((0 == i % 3) && shared.pop(value)) ++taken[value];
+  }
+  while (shared.pop(value)) ++taken[value];
+  done = true;
+  for (std::thread &thief : thieves) thief.join();
+
+  int mismatches = 0;
+  for (int i = 0; i < STEAL_ITEMS; ++i) {
+    if (1 != taken[i]) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Every item taken once");
+}
+
+void thread_pool_test(void) {
+  c_utils::ThreadPool pool(POOL_WORKERS);
+  c_utils::WaitGroup  group;
+  std::atomic<int>    count{ 0 };
+
+  TEST_ASSERT_EQUAL_VAL_MSG(POOL_WORKERS, pool.size(), "Pool workers");
+  for (int i = 0; i < 1000; ++i) pool.submit(group, [&count]() { ++count; });
+  pool.wait(group);
+  TEST_ASSERT_EQUAL_VAL_MSG(1000, count.load(), "Wait group tasks done");
+
+  // Nested: tasks submitting tasks and waiting on them from the workers
+  count = 0;
+  for (int i = 0; i < 16; ++i) {
+    pool.submit(group, [&pool, &count]() {
+      c_utils::WaitGroup inner;
+      for (int j = 0; j < 64; ++j) pool.submit(inner, [&count]() { ++count; });
+      pool.wait(inner);
+    });
+  }
+  group.wait();
+  TEST_ASSERT_EQUAL_VAL_MSG(16 * 64, count.load(), "Nested wait groups");
+
+  std::vector<int> hits(100003, 0);
+  pool.parallel_for(0, hits.size(), [&hits](std::size_t i) { hits[i] += 1; });
+  int mismatches = 0;
+  for (int hit : hits) {
+    if (1 != hit) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "parallel_for visits every index once");
+
+  count = 0;
+  pool.parallel_for(5, 5, [&count](std::size_t) { ++count; });
+  pool.parallel_for(0, 3, [&count](std::size_t) { ++count; }, 100);
+  TEST_ASSERT_EQUAL_VAL_MSG(3, count.load(), "parallel_for empty and single chunk ranges");
+
+  // Tasks pending on the destruction still run
+  count = 0;
+  {
+    c_utils::ThreadPool short_lived(2);
+    for (int i = 0; i < 100; ++i) short_lived.submit([&count]() { ++count; });
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(100, count.load(), "Pending tasks run before joining");
+}
+
+void parallel_interpolation_test(void) {
+  float const         a_data[] = { -22, -11, 0, 10, 20 };
+  float const         v_data[] = { -1.5, -1, 0, 1.2, 1.8 };
+  std::vector<float>  inputs(BATCH_LEN);
+  std::vector<float>  serial(BATCH_LEN);
+  std::vector<float>  parallel(BATCH_LEN);
+  c_utils::ThreadPool pool(POOL_WORKERS);
+
+  INTERP_TABLE_BUILD(steering_lut, a_data, v_data);
+  for (int i = 0; i < BATCH_LEN; ++i) inputs[i] = -30.0f + 60.0f * (float)i / BATCH_LEN;
+  interpolated_estimate_n(inputs.data(), serial.data(), BATCH_LEN, &steering_lut);
+
+  // One task per block so each call still runs the vector kernels
+  pool.parallel_for(0, BATCH_LEN / BATCH_BLOCK, [&](std::size_t block) {
+    std::size_t const first = block * BATCH_BLOCK;
+    interpolated_estimate_n(&inputs[first], &parallel[first], BATCH_BLOCK, &steering_lut);
+  });
+  TEST_ASSERT_EQUAL_VAL_MSG(true, serial == parallel, "Parallel batch shall match the serial batch");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(ws_deque_test, "Work-stealing deque owner and thieves");
+  uTEST_ADD_MSG(thread_pool_test, "Thread pool submit, wait groups and parallel_for");
+  uTEST_ADD_MSG(parallel_interpolation_test, "Batch interpolation split on the thread pool");
+
+  return (uTEST_END());
+}
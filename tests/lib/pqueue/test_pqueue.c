@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_pqueue.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for testing the Priority queue (4-ary heap) library.
+ */
+
+#include "pqueue.h"
+#include "uTest.h"
+#include <stdlib.h> /* rand, srand */
+
+#define RANDOM_ELEMS (1000)
+
+typedef struct job_s {
+  uint32_t deadline;
+  uint32_t id;
+} job_t;
+
+static bool_t min_first(uint32_t const *a, uint32_t const *b) {
+  return *a < *b;
+}
+
+static bool_t earliest_deadline(job_t const *a, job_t const *b) {
+  return a->deadline < b->deadline;
+}
+
+PQUEUE_CREATE(uint32_t, mins, RANDOM_ELEMS, min_first);
+PQUEUE_CREATE(job_t, jobs, 5, earliest_deadline);
+
+void pqueue_ops_test(void) {
+  job_t   job   = { 0 };
+  job_t   top   = { 0 };
+  uint8_t count = 0;
+
+  PQUEUE_FLUSH(jobs);
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, PQUEUE_POP(jobs, &top), "Pop empty");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, PQUEUE_TOP(jobs, &top), "Top empty");
+
+  for (uint32_t deadline = 50; deadline > 0; deadline -= 10) {
+    job.deadline = deadline;
+    job.id       = count++;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, PQUEUE_PUSH(jobs, &job), "Push");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, PQUEUE_SPACES(jobs), "Full");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, PQUEUE_PUSH(jobs, &job), "Push full");
+
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, PQUEUE_TOP(jobs, &top), "Top");
+  TEST_ASSERT_EQUAL_VAL_MSG(10, top.deadline, "Top is the earliest deadline");
+  TEST_ASSERT_EQUAL_VAL_MSG(5, pqueue_size(&jobs), "Top keeps the element");
+
+  for (uint32_t deadline = 10; deadline <= 50; deadline += 10) {
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, PQUEUE_POP(jobs, &top), "Pop");
+    TEST_ASSERT_EQUAL_VAL_MSG(deadline, top.deadline, "Popped in deadline order");
+    TEST_ASSERT_EQUAL_VAL_MSG(5 - deadline / 10, top.id, "Whole element popped");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, pqueue_size(&jobs), "Empty");
+}
+
+void pqueue_random_test(void) {
+  static uint32_t elems[RANDOM_ELEMS];
+  uint32_t        prev       = 0;
+  uint32_t        val        = 0;
+  uint32_t        mismatches = 0;
+
+  srand(7);
+  for (uint32_t round = 0; round < 2; ++round) {
+    PQUEUE_FLUSH(mins);
+    for (uint32_t i = 0; i < RANDOM_ELEMS; ++i) {
+      elems[i] = (uint32_t)rand() % 5000;
+    }
+    if (0 == round) {
+      for (uint32_t i = 0; i < RANDOM_ELEMS; ++i) PQUEUE_PUSH(mins, &elems[i]);
+    } else {
+      // Half pushed one by one, the other half at once
+      for (uint32_t i = 0; i < RANDOM_ELEMS / 2; ++i) PQUEUE_PUSH(mins, &elems[i]);
+      TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, PQUEUE_HEAPIFY(mins, elems, RANDOM_ELEMS), "Heapify out of space");
+      TEST_ASSERT_EQUAL_VAL_MSG(RANDOM_ELEMS / 2, pqueue_size(&mins), "None inserted");
+      TEST_ASSERT_EQUAL_VAL_MSG(OK, PQUEUE_HEAPIFY(mins, &elems[RANDOM_ELEMS / 2], RANDOM_ELEMS / 2),
+                                "Heapify");
+    }
+    TEST_ASSERT_EQUAL_VAL_MSG(RANDOM_ELEMS, pqueue_size(&mins), "All inserted");
+
+    // Interleaved pushes, the popped sequence shall never decrease
+    prev = 0;
+    for (uint32_t i = 0; i < RANDOM_ELEMS; ++i) {
+      PQUEUE_POP(mins, &val);
+      if (val < prev) ++mismatches;
+      prev = val;
+      if (0 == (i % 3)) {
+        val = prev + (uint32_t)rand() % 100;
+        PQUEUE_PUSH(mins, &val);
+      }
+    }
+    while (OK == PQUEUE_POP(mins, &val)) {
+      if (val < prev) ++mismatches;
+      prev = val;
+    }
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Random elements popped in order");
+}
+
+void pqueue_init_test(void) {
+  uint32_t buffer[9];
+  pqueue_t pq       = { 0 };
+  uint32_t elems[8] = { 8, 3, 5, 1, 9, 2, 7, 4 };
+  uint32_t val      = 0;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, pqueue_init(&pq, buffer, 8, sizeof(uint32_t), NULL), "No comparator");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, pqueue_init(&pq, buffer, 8, sizeof(uint32_t), mins_cmp_refd), "Init");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, pqueue_heapify(&pq, elems, 8), "Heapify to full");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, pqueue_pop(&pq, &val, 1), "Top");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, val, "Min at the root");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, pqueue_heapify(&pq, elems, 0), "Heapify none");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, pqueue_push(&pq, &val), "Push full");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, pqueue_reset(&pq), "Reset");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, pqueue_size(&pq), "Empty");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(pqueue_ops_test, "Priority queue push, top and pop");
+  uTEST_ADD_MSG(pqueue_random_test, "Priority queue random push, heapify and pop");
+  uTEST_ADD_MSG(pqueue_init_test, "Priority queue init on a user buffer");
+
+  return (uTEST_END());
+}
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C-UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_pqueue_cpp.cpp
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for test the C++ Priority queue (4-ary heap)
+ *
+ */
+
+#include "pqueue/pqueue.hpp"
+#include "uTest.h"
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+
+#define RANDOM_ELEMS (2000)
+
+struct Tracked {
+  static int live;
+  int        id;
+
+  explicit Tracked(int id_) : id(id_) {
+    ++live;
+  }
+  Tracked(Tracked const &other) : id(other.id) {
+    ++live;
+  }
+  Tracked(Tracked &&other) : id(other.id) {
+    ++live;
+  }
+  Tracked &operator=(Tracked const &) = default;
+  Tracked &operator=(Tracked &&)      = default;
+  ~Tracked() {
+    --live;
+  }
+  bool operator<(Tracked const &other) const {
+    return id < other.id;
+  }
+};
+int Tracked::live = 0;
+
+void pqueue_ops_test(void) {
+  c_utils::PriorityQueue<int, 4> pq;
+  int                            value = 0;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, pq.empty(), "New queue empty");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, pq.pop(), "Pop on empty queue");
+  for (int i : { 3, 9, 1, 7 }) pq.push(i);
+  TEST_ASSERT_EQUAL_VAL_MSG(true, pq.full(), "Full queue");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, pq.push(8), "Push on full queue");
+  TEST_ASSERT_EQUAL_VAL_MSG(9, pq.top(), "Top is the greatest");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, pq.pop(value), "Pop");
+  TEST_ASSERT_EQUAL_VAL_MSG(9, value, "Popped the greatest");
+  TEST_ASSERT_EQUAL_VAL_MSG(7, pq.top(), "Next greatest");
+
+  c_utils::PriorityQueue<int, 4> copy(pq);
+  TEST_ASSERT_EQUAL_VAL_MSG(true, copy.pop(), "Pop copy");
+  TEST_ASSERT_EQUAL_VAL_MSG(3, copy.top(), "Copy order");
+  TEST_ASSERT_EQUAL_VAL_MSG(7, pq.top(), "Source kept");
+  pq.clear();
+  TEST_ASSERT_EQUAL_VAL_MSG(0, pq.size(), "Cleared");
+
+  c_utils::PriorityQueue<std::string, 8, std::greater<std::string>> words;
+  for (char const *word : { "pear", "apple", "fig", "kiwi" }) words.emplace(word);
+  std::string first;
+  words.pop(first);
+  TEST_ASSERT_EQUAL_VAL_MSG(true, first == "apple", "Min first with std::greater");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, words.top() == "fig", "Next min");
+}
+
+void pqueue_random_test(void) {
+  c_utils::PriorityQueue<int, RANDOM_ELEMS> pq;
+  std::priority_queue<int>                  ref;
+  std::vector<int>                          elems(RANDOM_ELEMS);
+  int                                       mismatches = 0;
+  int                                       value      = 0;
+
+  std::srand(11);
+  for (int &elem : elems) elem = std::rand() % 10000;
+  // Half pushed one by one, the other half at once
+  for (int i = 0; i < RANDOM_ELEMS / 2; ++i) pq.push(elems[i]);
+  TEST_ASSERT_EQUAL_VAL_MSG(RANDOM_ELEMS / 2, pq.push_bulk(&elems[RANDOM_ELEMS / 2], RANDOM_ELEMS),
+                            "Bulk push as many as free slots");
+  for (int elem : elems) ref.push(elem);
+
+  for (int i = 0; i < RANDOM_ELEMS; ++i) {
+    pq.pop(value);
+    if (value != ref.top()) ++mismatches;
+    ref.pop();
+    if (0 == (i % 4)) {
+      value = std::rand() % 10000;
+      pq.push(value);
+      ref.push(value);
+    }
+  }
+  while (!ref.empty()) {
+    if (!pq.pop(value) || (value != ref.top())) ++mismatches;
+    ref.pop();
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Same order as std::priority_queue");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, pq.empty(), "Emptied");
+}
+
+void pqueue_lifetime_test(void) {
+  {
+    c_utils::PriorityQueue<Tracked, 16> pq;
+    for (int i = 0; i < 10; ++i) pq.emplace((i * 7) % 10);
+    TEST_ASSERT_EQUAL_VAL_MSG(10, Tracked::live, "Live elements");
+    pq.pop();
+    TEST_ASSERT_EQUAL_VAL_MSG(9, Tracked::live, "Popped element destroyed");
+    TEST_ASSERT_EQUAL_VAL_MSG(8, pq.top().id, "Top after pop");
+
+    c_utils::PriorityQueue<Tracked, 16> moved(std::move(pq));
+    TEST_ASSERT_EQUAL_VAL_MSG(8, moved.top().id, "Moved order");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, Tracked::live, "All elements destroyed");
+
+  auto const by_value = [](std::unique_ptr<int> const &a, std::unique_ptr<int> const &b) { return *a < *b; };
+  c_utils::PriorityQueue<std::unique_ptr<int>, 8, decltype(by_value)> owners(by_value);
+  for (int i : { 4, 2, 6 }) owners.push(std::make_unique<int>(i));
+  std::unique_ptr<int> owner;
+  owners.pop(owner);
+  TEST_ASSERT_EQUAL_VAL_MSG(6, *owner, "Move-only elements");
+  TEST_ASSERT_EQUAL_VAL_MSG(4, *owners.top(), "Move-only next");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(pqueue_ops_test, "Priority queue push, top and pop");
+  uTEST_ADD_MSG(pqueue_random_test, "Priority queue against std::priority_queue");
+  uTEST_ADD_MSG(pqueue_lifetime_test, "Priority queue element lifetime");
+
+  return (uTEST_END());
+}
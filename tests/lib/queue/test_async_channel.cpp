@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C-UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_async_channel.cpp
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for test the coroutine async channel (C++20)
+ *
+ */
+
+#include "queue/async_channel.hpp"
+#include "queue/queue.hpp" // Also included by the channel, shall be guarded
+#include "uTest.h"
+#include <cstdlib>
+#include <new>
+#include <poll.h>
+#include <string>
+
+#define CHANNEL_MSGS (1000)
+
+// Counts the heap allocations of the whole program
+static std::size_t heap_allocs = 0;
+
+void *operator new(std::size_t size) {
+  ++heap_allocs;
+  void *ptr = std::malloc(size ? size : 1);
+  if (nullptr == ptr) throw std::bad_alloc();
+  return ptr;
+}
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+static c_utils::Task producer(c_utils::AsyncChannel<int, 2> &channel, int first, int count, int &suspends) {
+  for (int i = first; i < first + count; ++i) {
+    if (2 == channel.size()) ++suspends;
+    co_await channel.enqueue(i);
+  }
+}
+
+static c_utils::Task consumer(c_utils::AsyncChannel<int, 2> &channel, long long &sum, int &received,
+                              int &order) {
+  int last = -1;
+  while (std::optional<int> value = co_await channel.dequeue()) {
+    if (*value <= last) ++order;
+    last  = *value;
+    sum  += *value;
+    ++received;
+  }
+}
+
+void channel_test(void) {
+  c_utils::Scheduler            scheduler;
+  c_utils::AsyncChannel<int, 2> channel(scheduler);
+  long long                     sum      = 0;
+  int                           received = 0;
+  int                           order    = 0;
+  int                           suspends = 0;
+
+  scheduler.spawn(consumer(channel, sum, received, order));
+  scheduler.spawn(producer(channel, 0, CHANNEL_MSGS, suspends));
+  scheduler.run();
+  TEST_ASSERT_EQUAL_VAL_MSG(CHANNEL_MSGS, received, "Every message received");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, order, "Messages in order");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, 0 < suspends, "Producer suspended on a full channel");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, scheduler.idle(), "Consumer suspended on an empty channel");
+
+  // Steady state: the frames of the finished tasks are recycled, no heap allocation at all
+  std::size_t const allocs = heap_allocs;
+  scheduler.spawn(producer(channel, CHANNEL_MSGS, CHANNEL_MSGS, suspends));
+  scheduler.run();
+  TEST_ASSERT_EQUAL_VAL_MSG(allocs, heap_allocs, "Suspend and resume without heap allocations");
+  TEST_ASSERT_EQUAL_VAL_MSG(2 * CHANNEL_MSGS, received, "Every message of the second producer received");
+
+  channel.close();
+  scheduler.run();
+  long long const total = 2LL * CHANNEL_MSGS;
+  TEST_ASSERT_EQUAL_VAL_MSG(total * (total - 1) / 2, sum, "Consumer finished on close");
+}
+
+static c_utils::Task closed_sender(c_utils::AsyncChannel<std::string, 1> &channel, int &fails) {
+  for (int i = 0; i < 3; ++i) {
+    if (!co_await channel.enqueue(std::string(32, 'a' + i))) ++fails;
+  }
+}
+
+static c_utils::Task drain(c_utils::AsyncChannel<std::string, 1> &channel, std::string &out) {
+  while (std::optional<std::string> value = co_await channel.dequeue()) out += value->back();
+}
+
+void channel_close_test(void) {
+  c_utils::Scheduler                    scheduler(true);
+  c_utils::AsyncChannel<std::string, 1> channel(scheduler);
+  int                                   fails = 0;
+  std::string                           out;
+  pollfd                                pfd = { scheduler.event_fd(), POLLIN, 0 };
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, 0 <= scheduler.event_fd(), "Scheduler eventfd");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, poll(&pfd, 1, 0), "Nothing ready");
+  scheduler.spawn(closed_sender(channel, fails));
+  TEST_ASSERT_EQUAL_VAL_MSG(1, poll(&pfd, 1, 0), "Ready coroutine signaled on the eventfd");
+  scheduler.run();
+  TEST_ASSERT_EQUAL_VAL_MSG(0, poll(&pfd, 1, 0), "eventfd cleared by run");
+
+  // 'a' buffered, 'b' suspended on the full channel, then closed
+  channel.close();
+  scheduler.run();
+  TEST_ASSERT_EQUAL_VAL_MSG(2, fails, "Suspended and later sends fail once closed");
+  scheduler.spawn(drain(channel, out));
+  scheduler.run();
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string("a"), out, "Buffered messages drained after close");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(channel_test, "Async channel producer and consumer coroutines");
+  uTEST_ADD_MSG(channel_close_test, "Async channel close and eventfd scheduler");
+
+  return (uTEST_END());
+}
@@ -0,0 +1,529 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C-UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_queue.cpp
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for test the Queue class library
+ *
+ */
+
+#include "queue/dynamic_queue.hpp"
+#include "queue/mpmc_queue.hpp"
+#include "queue/queue.hpp"
+#include "queue/spsc_queue.hpp"
+#include "uTest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define CROSS_THREAD_MSGS (1000000)
+#define MPMC_THREADS      (4)
+#define MPMC_MSGS_PER_THD (100000)
+#define HUGE_QUEUE_LEN    (1 << 20)
+
+// Counts the live instances to check every constructed element is destroyed
+struct Tracked {
+  static int live;
+  int        id;
+
+  explicit Tracked(int id_) : id(id_) {
+    ++live;
+  }
+  Tracked(Tracked const &other) : id(other.id) {
+    ++live;
+  }
+  Tracked(Tracked &&other) : id(other.id) {
+    ++live;
+  }
+  Tracked &operator=(Tracked const &) = default;
+  Tracked &operator=(Tracked &&)      = default;
+  ~Tracked() {
+    --live;
+  }
+};
+int Tracked::live = 0;
+
+void queue_fifo_test(void) {
+  c_utils::Queue<int, 4> queue;
+  int                    value = 0;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.empty(), "New queue empty");
+  for (int i = 1; i <= 4; ++i) queue.enqueue(i);
+  TEST_ASSERT_EQUAL_VAL_MSG(4, queue.size(), "Full queue size");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.enqueue(5), "Enqueue on full queue");
+
+  queue.push(5); // drops 1
+  TEST_ASSERT_EQUAL_VAL_MSG(4, queue.size(), "Push on full queue size");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.dequeue(value), "Dequeue");
+  TEST_ASSERT_EQUAL_VAL_MSG(2, value, "Oldest element dropped by push");
+  TEST_ASSERT_EQUAL_VAL_MSG(3, queue.front(), "Front");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.pop(), "Pop");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, queue.size(), "Size after removals");
+  TEST_ASSERT_EQUAL_VAL_MSG(5, queue.front(), "Last element");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.pop(), "Pop on empty queue");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.dequeue(value), "Dequeue on empty queue");
+}
+
+void queue_move_test(void) {
+  c_utils::Queue<std::unique_ptr<int>, 3> queue;
+  std::unique_ptr<int>                    value;
+
+  queue.push(std::make_unique<int>(1));
+  queue.enqueue(std::make_unique<int>(2));
+  queue.emplace(new int(3));
+  queue.emplace(new int(4)); // drops 1
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.dequeue(value), "Move-only dequeue");
+  TEST_ASSERT_EQUAL_VAL_MSG(2, *value, "Move-only oldest");
+  TEST_ASSERT_EQUAL_VAL_MSG(3, *queue.front(), "Move-only front");
+
+  c_utils::Queue<std::unique_ptr<int>, 3> moved(std::move(queue));
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.empty(), "Moved from queue empty");
+  TEST_ASSERT_EQUAL_VAL_MSG(4, *moved.front(), "Moved queue element");
+
+  c_utils::Queue<std::string, 2> strings;
+  std::string                    text(64, 'x');
+  strings.push(std::move(text));
+  strings.emplace(32, 'y');
+  c_utils::Queue<std::string, 2> copy(strings);
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(64, 'x'), copy.front(), "Copied string");
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(32, 'y'), copy.front(), "Copied emplaced string");
+  TEST_ASSERT_EQUAL_VAL_MSG(2, strings.size(), "Copy source unchanged");
+
+  // Full queue, the oldest element is pushed again while it's dropped
+  strings.push(strings[0]);
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(32, 'y'), strings[0], "Self push dropped the oldest");
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(64, 'x'), strings[1], "Self push on a full queue");
+  strings.emplace(strings[0]);
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(64, 'x'), strings[0], "Self emplace dropped the oldest");
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(32, 'y'), strings[1], "Self emplace on a full queue");
+}
+
+void queue_lifetime_test(void) {
+  {
+    c_utils::Queue<Tracked, 4> queue; // Tracked has no default constructor
+    TEST_ASSERT_EQUAL_VAL_MSG(0, Tracked::live, "No construction up front");
+
+    for (int i = 0; i < 6; ++i) queue.emplace(i);
+    TEST_ASSERT_EQUAL_VAL_MSG(4, Tracked::live, "Dropped elements destroyed");
+    queue.pop();
+    TEST_ASSERT_EQUAL_VAL_MSG(3, Tracked::live, "Popped element destroyed");
+
+    c_utils::Queue<Tracked, 4> other;
+    other.emplace(9);
+    other = queue;
+    TEST_ASSERT_EQUAL_VAL_MSG(6, Tracked::live, "Copy assignment");
+    other.clear();
+    TEST_ASSERT_EQUAL_VAL_MSG(3, Tracked::live, "Clear");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, Tracked::live, "Live elements destroyed with the queue");
+}
+
+void queue_bulk_test(void) {
+  c_utils::Queue<int, 8> queue;
+  int const              input[10]  = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  int                    output[10] = { 0 };
+  int                    value      = 0;
+
+  // Move the head and the tail to the middle so the runs wrap
+  queue.enqueue_bulk(input, 5);
+  TEST_ASSERT_EQUAL_VAL_MSG(5, queue.dequeue_bulk(output, 5), "Bulk dequeue");
+  TEST_ASSERT_EQUAL_VAL_MSG(6, queue.enqueue_bulk(input, 6), "Bulk enqueue across the wrap");
+  TEST_ASSERT_EQUAL_VAL_MSG(2, queue.enqueue_bulk(input + 6, 4), "Bulk enqueue up to the free slots");
+  TEST_ASSERT_EQUAL_VAL_MSG(8, queue.size(), "Bulk enqueue fills the queue");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, queue.enqueue_bulk(input, 1), "Bulk enqueue on full queue");
+  queue.dequeue(value);
+  TEST_ASSERT_EQUAL_VAL_MSG(0, value, "Single dequeue after bulk");
+  TEST_ASSERT_EQUAL_VAL_MSG(7, queue.dequeue_bulk(output, 10), "Bulk dequeue up to the size");
+  int mismatches = 0;
+  for (int i = 0; i < 7; ++i) {
+    if (i + 1 != output[i]) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Bulk order across the wrap");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.empty(), "Bulk dequeue empties");
+
+#if __cplusplus >= 202002L
+  TEST_ASSERT_EQUAL_VAL_MSG(8, queue.enqueue_bulk(std::span<int const>(input)), "Span enqueue");
+  TEST_ASSERT_EQUAL_VAL_MSG(8, queue.dequeue_bulk(std::span<int>(output)), "Span dequeue");
+#endif
+
+  // Non trivially copyable elements
+  c_utils::Queue<std::string, 3> strings;
+  std::string const              words[] = { "alpha", "beta", "gamma", "delta" };
+  std::string                    out[2];
+  strings.push("zero");
+  strings.pop();
+  TEST_ASSERT_EQUAL_VAL_MSG(3, strings.enqueue_bulk(words, 4), "String bulk enqueue");
+  TEST_ASSERT_EQUAL_VAL_MSG(2, strings.dequeue_bulk(out, 2), "String bulk dequeue");
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string("beta"), out[1], "String bulk order");
+
+  std::string joined;
+  strings.enqueue_bulk(words + 3, 1);
+  TEST_ASSERT_EQUAL_VAL_MSG(2, strings.drain([&joined](std::string &word) { joined += word; }), "Drain");
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string("gammadelta"), joined, "Drain order across the wrap");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, strings.empty(), "Drain empties");
+
+  {
+    c_utils::Queue<Tracked, 4> tracked;
+    Tracked const              items[] = { Tracked(1), Tracked(2), Tracked(3) };
+    tracked.enqueue_bulk(items, 3);
+    tracked.drain([](Tracked &) {});
+    TEST_ASSERT_EQUAL_VAL_MSG(3, Tracked::live, "Drained elements destroyed");
+  }
+}
+
+#if __cplusplus >= 202002L
+static_assert(std::random_access_iterator<c_utils::Queue<int, 5>::const_iterator>, "Random access iterator");
+#endif
+
+void queue_iterator_test(void) {
+  c_utils::Queue<int, 5> queue;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.begin() == queue.end(), "Empty range");
+  // Tail in the middle and a full queue, so the elements wrap: { 3, 4, 5, 6, 7 }
+  for (int i = 1; i <= 7; ++i) queue.push(i);
+
+  TEST_ASSERT_EQUAL_VAL_MSG(5, std::distance(queue.begin(), queue.end()), "Full range");
+  TEST_ASSERT_EQUAL_VAL_MSG(25, std::accumulate(queue.begin(), queue.end(), 0), "Accumulate in place");
+  TEST_ASSERT_EQUAL_VAL_MSG(3, std::find(queue.begin(), queue.end(), 6) - queue.begin(), "Find");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.end() == std::find(queue.begin(), queue.end(), 1), "Dropped element");
+  TEST_ASSERT_EQUAL_VAL_MSG(3, queue[0], "Index of the oldest");
+  TEST_ASSERT_EQUAL_VAL_MSG(7, queue[4], "Index of the newest");
+
+  int expected   = 3;
+  int mismatches = 0;
+  for (int value : queue) {
+    if (expected++ != value) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Range-for across the wrap");
+
+  c_utils::Queue<int, 5>::const_iterator it = queue.begin() + 4;
+  TEST_ASSERT_EQUAL_VAL_MSG(7, *it, "Iterator arithmetic");
+  TEST_ASSERT_EQUAL_VAL_MSG(4, it[-3], "Iterator subscript");
+  TEST_ASSERT_EQUAL_VAL_MSG(6, *--it, "Iterator decrement");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, (queue.begin() < it) && (it < queue.end()), "Iterator ordering");
+  TEST_ASSERT_EQUAL_VAL_MSG(7, *std::max_element(queue.cbegin(), queue.cend()), "Max element");
+
+  queue[1] = 40;
+  TEST_ASSERT_EQUAL_VAL_MSG(false, std::is_sorted(queue.begin(), queue.end()), "Write by index");
+  queue.pop();
+  TEST_ASSERT_EQUAL_VAL_MSG(40, *queue.begin(), "Begin follows the tail");
+}
+
+// Stateful allocator not propagated on move assignment, frees only the memory it allocated
+template <class T> struct TaggedAllocator {
+  using value_type                             = T;
+  using propagate_on_container_move_assignment = std::false_type;
+  static int foreign_frees;
+  int        tag;
+
+  explicit TaggedAllocator(int tag_) : tag(tag_) {}
+  template <class U> TaggedAllocator(TaggedAllocator<U> const &other) : tag(other.tag) {}
+
+  T *allocate(std::size_t count) {
+    int *mem = static_cast<int *>(::operator new(sizeof(int) * 2 + count * sizeof(T)));
+    *mem     = tag;
+    return reinterpret_cast<T *>(mem + 2);
+  }
+  void deallocate(T *ptr, std::size_t) {
+    int *mem = reinterpret_cast<int *>(ptr) - 2;
+    if (*mem != tag) ++foreign_frees;
+    ::operator delete(mem);
+  }
+  friend bool operator==(TaggedAllocator const &a, TaggedAllocator const &b) {
+    return a.tag == b.tag;
+  }
+  friend bool operator!=(TaggedAllocator const &a, TaggedAllocator const &b) {
+    return a.tag != b.tag;
+  }
+};
+template <class T> int TaggedAllocator<T>::foreign_frees = 0;
+
+void dynamic_queue_move_test(void) {
+  c_utils::DynamicQueue<std::string> queue(8);
+  std::string                        value;
+
+  for (int i = 0; i < 5; ++i) queue.enqueue(std::to_string(i));
+  c_utils::DynamicQueue<std::string> moved(std::move(queue));
+  TEST_ASSERT_EQUAL_VAL_MSG(0, queue.capacity(), "Moved from queue has no slots");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.enqueue("x"), "Enqueue on moved from queue");
+  queue.push("y"); // Allocates a single slot
+  TEST_ASSERT_EQUAL_VAL_MSG(1, queue.capacity(), "Push on moved from queue allocates");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.dequeue(value) && ("y" == value), "Moved from queue usable");
+
+  queue = std::move(moved);
+  TEST_ASSERT_EQUAL_VAL_MSG(8, queue.capacity(), "Move assigned capacity");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, moved.capacity(), "Move assigned from queue has no slots");
+
+  // Unequal allocators not propagated: elements moved one by one, each buffer freed by its allocator
+  using Tagged      = TaggedAllocator<std::string>;
+  using TaggedQueue = c_utils::DynamicQueue<std::string, Tagged>;
+  {
+    TaggedQueue first(4, Tagged(1));
+    TaggedQueue second(2, Tagged(2));
+    for (int i = 0; i < 3; ++i) first.enqueue(std::string(24, static_cast<char>('a' + i)));
+    second = std::move(first);
+    TEST_ASSERT_EQUAL_VAL_MSG(2, second.get_allocator().tag, "Allocator kept");
+    TEST_ASSERT_EQUAL_VAL_MSG(4, second.capacity(), "Capacity of the other queue");
+    TEST_ASSERT_EQUAL_VAL_MSG(3, second.size(), "Elements moved");
+    TEST_ASSERT_EQUAL_VAL_MSG(true, first.empty(), "Moved from queue empty");
+    TEST_ASSERT_EQUAL_VAL_MSG(0, first.capacity(), "Moved from queue buffer released");
+    TEST_ASSERT_EQUAL_VAL_MSG(true, second.dequeue(value) && (std::string(24, 'a') == value), "Order kept");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, Tagged::foreign_frees, "Every buffer freed by its own allocator");
+
+  // Full queue, the oldest element is pushed again while it's dropped
+  c_utils::DynamicQueue<std::string> full(2);
+  std::string const                 &oldest = full.emplace(24, 'a');
+  full.emplace(24, 'b');
+  full.push(oldest);
+  TEST_ASSERT_EQUAL_VAL_MSG(true, full.dequeue(value) && (std::string(24, 'b') == value), "Self push drop");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, full.dequeue(value) && (std::string(24, 'a') == value), "Self push");
+}
+
+void dynamic_queue_test(void) {
+  c_utils::DynamicQueue<std::string> queue(3);
+  std::string                        value;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(4, queue.capacity(), "Capacity rounded up to a power of 2");
+  for (char c = 'a'; c <= 'd'; ++c) queue.enqueue(std::string(24, c));
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.enqueue("e"), "Enqueue on full queue");
+  queue.emplace(24, 'e'); // drops 'a'
+  TEST_ASSERT_EQUAL_VAL_MSG(4, queue.size(), "Emplace on full queue size");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.dequeue(value), "Dequeue");
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(24, 'b'), value, "Oldest element dropped by emplace");
+
+  c_utils::DynamicQueue<std::string> moved(std::move(queue));
+  TEST_ASSERT_EQUAL_VAL_MSG(3, moved.size(), "Moved queue size");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.empty(), "Moved from queue empty");
+
+  {
+    c_utils::DynamicQueue<Tracked> tracked(100);
+    for (int i = 0; i < 300; ++i) tracked.emplace(i);
+    TEST_ASSERT_EQUAL_VAL_MSG(128, Tracked::live, "Dropped elements destroyed");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, Tracked::live, "Live elements destroyed with the queue");
+
+  // 4 MiB of slots mapped on huge pages (or regular pages advised for THP)
+  using HugeQueue = c_utils::DynamicQueue<int, c_utils::HugePageAllocator<int>>;
+  HugeQueue huge(HUGE_QUEUE_LEN);
+  int       mismatches = 0;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(2 * HUGE_PAGE_SIZE, c_utils::HugePageAllocator<int>::map_length(HUGE_QUEUE_LEN),
+                            "Whole huge pages mapped");
+  for (int i = 0; i < HUGE_QUEUE_LEN; ++i) huge.enqueue(i);
+  TEST_ASSERT_EQUAL_VAL_MSG(false, huge.enqueue(-1), "Huge queue full");
+  for (int i = 0; i < HUGE_QUEUE_LEN; ++i) {
+    int v = -1;
+    if (!huge.dequeue(v) || (v != i)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Huge queue order");
+
+  c_utils::DynamicQueue<char, c_utils::HugePageAllocator<char>> small(100);
+  TEST_ASSERT_EQUAL_VAL_MSG(true, small.enqueue('x'), "Small queue on a regular page");
+}
+
+void spsc_queue_test(void) {
+  c_utils::SpscQueue<std::string, 3> queue;
+  std::string                        value;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.empty(), "New SPSC queue empty");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.enqueue(std::string(40, 'a')), "SPSC enqueue");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.emplace(40, 'b'), "SPSC emplace");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.enqueue("c"), "SPSC enqueue last slot");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.enqueue("d"), "SPSC enqueue on full queue");
+  TEST_ASSERT_EQUAL_VAL_MSG(3, queue.size(), "SPSC full size");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.dequeue(value), "SPSC dequeue");
+  TEST_ASSERT_EQUAL_VAL_MSG(std::string(40, 'a'), value, "SPSC oldest element");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.enqueue("d"), "SPSC enqueue after dequeue");
+  for (char c : { 'b', 'c', 'd' }) {
+    queue.dequeue(value);
+    TEST_ASSERT_EQUAL_VAL_MSG(c, value.back(), "SPSC order across the wrap");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.dequeue(value), "SPSC dequeue on empty queue");
+
+  {
+    c_utils::SpscQueue<Tracked, 4> tracked;
+    tracked.emplace(1);
+    tracked.emplace(2);
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, Tracked::live, "SPSC live elements destroyed with the queue");
+}
+
+// Producer thread to consumer thread message rate, returns the messages out of order (expected 0)
+template <class Send, class Receive>
+static int cross_thread_run(char const *name, Send send, Receive receive) {
+  int  mismatches = 0;
+  auto start      = std::chrono::steady_clock::now();
+
+  std::thread producer([&send]() {
+    for (int i = 0; i < CROSS_THREAD_MSGS; ++i) {
+      while (!send(i)) std::this_thread::yield();
+    }
+  });
+  for (int i = 0; i < CROSS_THREAD_MSGS; ++i) {
+    int value = -1;
+    while (!receive(value)) std::this_thread::yield();
+    if (value != i) ++mismatches;
+  }
+  producer.join();
+
+  std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+  printf("   %-22s %8.2f Mmsg/s\n", name, CROSS_THREAD_MSGS / elapsed.count() / 1e6);
+  return mismatches;
+}
+
+void spsc_queue_rate_test(void) {
+  static c_utils::SpscQueue<int, 1024> spsc;
+  static c_utils::Queue<int, 1024>     locked;
+  std::mutex                           lock;
+
+  int mismatches = cross_thread_run(
+      "SpscQueue", [](int v) { return spsc.enqueue(v); }, [](int &v) { return spsc.dequeue(v); });
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "SPSC cross thread order");
+
+  mismatches = cross_thread_run(
+      "Queue + std::mutex",
+      [&lock](int v) {
+        std::lock_guard<std::mutex> guard(lock);
+        return locked.enqueue(v);
+      },
+      [&lock](int &v) {
+        std::lock_guard<std::mutex> guard(lock);
+        return locked.dequeue(v);
+      });
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Locked Queue cross thread order");
+}
+
+void mpmc_queue_test(void) {
+  c_utils::MpmcQueue<std::unique_ptr<int>, 2> queue;
+  std::unique_ptr<int>                        value;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.empty(), "New MPMC queue empty");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.try_enqueue(std::make_unique<int>(1)), "MPMC enqueue");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, queue.try_emplace(new int(2)), "MPMC emplace");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, queue.try_enqueue(std::make_unique<int>(3)), "MPMC enqueue on full queue");
+  TEST_ASSERT_EQUAL_VAL_MSG(2, queue.size(), "MPMC full size");
+  for (int i = 1; i <= 4; ++i) {
+    TEST_ASSERT_EQUAL_VAL_MSG(true, queue.try_dequeue(value), "MPMC dequeue");
+    TEST_ASSERT_EQUAL_VAL_MSG(i, *value, "MPMC order across the laps");
+    queue.try_enqueue(std::make_unique<int>(i + 2));
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(2, queue.size(), "MPMC size after the laps");
+
+  {
+    c_utils::MpmcQueue<Tracked, 4> tracked;
+    tracked.try_emplace(1);
+    tracked.try_emplace(2);
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, Tracked::live, "MPMC live elements destroyed with the queue");
+}
+
+// N producers to N consumers through the queue, returns the sum of all the received values
+template <class Send, class Receive>
+static long long many_to_many_run(char const *name, Send send, Receive receive) {
+  std::atomic<long long>   sum{ 0 };
+  std::vector<std::thread> threads;
+  auto                     start = std::chrono::steady_clock::now();
+
+  for (int t = 0; t < MPMC_THREADS; ++t) {
+    threads.emplace_back([&send, t]() {
+      for (int i = 0; i < MPMC_MSGS_PER_THD; ++i) send(t * MPMC_MSGS_PER_THD + i);
+    });
+    threads.emplace_back([&receive, &sum]() {
+      long long partial = 0;
+      for (int i = 0; i < MPMC_MSGS_PER_THD; ++i) partial += receive();
+      sum += partial;
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+  printf("   %-22s %8.2f Mmsg/s\n", name, MPMC_THREADS * MPMC_MSGS_PER_THD / elapsed.count() / 1e6);
+  return sum;
+}
+
+void mpmc_queue_rate_test(void) {
+  static c_utils::MpmcQueue<int, 256> mpmc;
+  static c_utils::Queue<int, 256>     locked;
+  std::mutex                          lock;
+  std::condition_variable             not_empty;
+  std::condition_variable             not_full;
+  long long const                     total = (long long)MPMC_THREADS * MPMC_MSGS_PER_THD;
+  long long const                     sum   = total * (total - 1) / 2;
+
+  long long received = many_to_many_run(
+      "MpmcQueue (blocking)", [](int v) { mpmc.wait_enqueue(v); },
+      []() {
+        int v = 0;
+        mpmc.wait_dequeue(v);
+        return v;
+      });
+  TEST_ASSERT_EQUAL_VAL_MSG(sum, received, "MPMC every message received once");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, mpmc.empty(), "MPMC drained");
+
+  received = many_to_many_run(
+      "Queue + mutex/condvar",
+      [&](int v) {
+        std::unique_lock<std::mutex> guard(lock);
+        not_full.wait(guard, []() { return locked.size() < 256; });
+        locked.enqueue(v);
+        not_empty.notify_one();
+      },
+      [&]() {
+        std::unique_lock<std::mutex> guard(lock);
+        not_empty.wait(guard, []() { return !locked.empty(); });
+        int const v = locked.front();
+        not_full.notify_one();
+        return v;
+      });
+  TEST_ASSERT_EQUAL_VAL_MSG(sum, received, "Locked Queue every message received once");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(queue_fifo_test, "Queue FIFO order, overwrite and size");
+  uTEST_ADD_MSG(queue_move_test, "Queue move-only and string payloads");
+  uTEST_ADD_MSG(queue_lifetime_test, "Queue element construction and destruction");
+  uTEST_ADD_MSG(queue_bulk_test, "Queue bulk transfers and drain");
+  uTEST_ADD_MSG(queue_iterator_test, "Queue iterators and index in place");
+  uTEST_ADD_MSG(dynamic_queue_test, "DynamicQueue runtime capacity and allocators");
+  uTEST_ADD_MSG(dynamic_queue_move_test, "DynamicQueue moved from state and unequal allocators");
+  uTEST_ADD_MSG(spsc_queue_test, "SpscQueue FIFO order and capacity");
+  uTEST_ADD_MSG(spsc_queue_rate_test, "SpscQueue against a locked Queue, cross thread message rate");
+  uTEST_ADD_MSG(mpmc_queue_test, "MpmcQueue FIFO order and capacity");
+  uTEST_ADD_MSG(mpmc_queue_rate_test, "MpmcQueue against a locked Queue, many to many message rate");
+
+  return (uTEST_END());
+}
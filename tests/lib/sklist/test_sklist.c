@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of UTILS_C                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_sklist.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for testing the sklist library.
+ */
+
+#include "sklist.h"
+#include "uTest.h"
+#include <pthread.h> /* pthread_create, pthread_join */
+#include <stdio.h>   /* printf */
+#include <stdlib.h>  /* malloc, free*/
+
+#define MAX_SKLIST_LEN (100000)
+#define NUM_THREADS    (4)
+#define KEYS_PER_THD   (20000)
+
+typedef struct my_struct {
+  uint8_t  dummy;
+  uint32_t data;
+} my_struct_t;
+
+typedef struct range_ctx {
+  sk_key_t last;
+  uint32_t count;
+  uint32_t limit;
+  bool_t   ordered;
+} range_ctx_t;
+
+static base_t check_range(sk_key_t key, void *data, void *ctx) {
+  range_ctx_t *r = (range_ctx_t *)ctx;
+
+  if ((0 != r->count) && (key <= r->last)) r->ordered = false;
+  if ((sk_key_t)((my_struct_t *)data)->data != key) r->ordered = false;
+  r->last = key;
+  ++r->count;
+
+  return (r->count < r->limit) ? OK : NOT_OK;
+}
+
+/* Visits the keys in a scrambled order, 7919 is coprime with MAX_SKLIST_LEN */
+static sk_key_t scrambled_key(uint32_t i) {
+  return (sk_key_t)(((uint64_t)i * 7919U) % MAX_SKLIST_LEN);
+}
+
+void test_sklist_no_macros() {
+  sk_list_t   list = { 0 };
+  my_struct_t obj  = { 0 };
+
+  for (uint32_t i = 0; i < MAX_SKLIST_LEN; ++i) {
+    obj.data = (uint32_t)scrambled_key(i);
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, sklist_insert(&list, scrambled_key(i), &obj, sizeof(obj)),
+                              "Failed to insert");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_SKLIST_LEN, sklist_get_size(&list), "sklist shall be holding all the keys");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, sklist_insert(&list, 10, &obj, sizeof(obj)), "Duplicated key shall fail");
+
+  for (uint32_t i = 0; i < MAX_SKLIST_LEN; i += 97) {
+    my_struct_t *ret = (my_struct_t *)sklist_search(&list, (sk_key_t)i);
+    if (NULL == ret) {
+      sklist_delete_list(&list);
+      TEST_ASSERT_FAIL("ERROR: search shall not return NULL");
+    }
+    TEST_ASSERT_EQUAL_VAL_MSG(i, ret->data, "Search shall find the key");
+  }
+  TEST_ASSERT_EQUAL_MSG(NULL, sklist_search(&list, MAX_SKLIST_LEN), "Key not present shall return NULL");
+  TEST_ASSERT_EQUAL_MSG(NULL, sklist_search(&list, -1), "Key not present shall return NULL");
+
+  range_ctx_t r = { 0, 0, MAX_SKLIST_LEN, true };
+  TEST_ASSERT_EQUAL_VAL_MSG(101, sklist_range(&list, 1000, 1100, check_range, &r), "Inclusive range");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, r.ordered, "Range shall be visited in ascending order");
+
+  range_ctx_t stop = { 0, 0, 10, true };
+  TEST_ASSERT_EQUAL_VAL_MSG(10, sklist_range(&list, 0, MAX_SKLIST_LEN, check_range, &stop), "Visitor stops");
+
+  // Remove the even keys
+  for (uint32_t i = 0; i < MAX_SKLIST_LEN; i += 2) {
+    void *data = NULL;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, sklist_remove(&list, (sk_key_t)i, &data), "Failed to remove");
+    TEST_ASSERT_EQUAL_VAL_MSG(i, ((my_struct_t *)data)->data, "Removed data shall match the key");
+    free(data);
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(MAX_SKLIST_LEN / 2, sklist_get_size(&list), "Half of the keys removed");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, sklist_remove(&list, 0, NULL), "Key already removed");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, sklist_remove(&list, 1, NULL), "Remove freeing the data");
+
+  range_ctx_t odd = { 0, 0, MAX_SKLIST_LEN, true };
+  TEST_ASSERT_EQUAL_VAL_MSG(5, sklist_range(&list, 0, 11, check_range, &odd), "Only odd keys left");
+
+  sklist_delete_list(&list);
+  TEST_ASSERT_EQUAL_VAL_MSG(0, sklist_get_size(&list), "sklist shall be empty");
+  TEST_ASSERT_EQUAL_MSG(NULL, sklist_search(&list, 3), "sklist is empty, shall return NULL");
+}
+
+/** Declaring my_struct_index global skip list and the typed helpers */
+SKLIST_TYPE_CREATE(my_struct_t, my_struct_index);
+
+void test_sklist_with_macros() {
+  my_struct_t obj = { 0 };
+
+  for (uint32_t i = 0; i < 10; ++i) {
+    obj.data = i * 10;
+    TEST_ASSERT_EQUAL_VAL_MSG(OK, SKLIST_INSERT(i, obj, my_struct_index), "Failed to insert");
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, SKLIST_SEARCH_REF(my_struct_index, 4, &obj), "Key shall be found");
+  TEST_ASSERT_EQUAL_VAL_MSG(40, obj.data, "Search data");
+  TEST_ASSERT_EQUAL_VAL_MSG(OK, SKLIST_REMOVE_REF(my_struct_index, 5, &obj), "Key shall be removed");
+  TEST_ASSERT_EQUAL_VAL_MSG(50, obj.data, "Removed data");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, SKLIST_SEARCH_REF(my_struct_index, 5, &obj), "Key already removed");
+  TEST_ASSERT_EQUAL_VAL_MSG(9, sklist_get_size(&my_struct_index), "Size after remove");
+  sklist_delete_list(&my_struct_index);
+}
+
+static sk_chandle_t shared = NULL;
+
+static void *conc_worker(void *arg) {
+  uint32_t const base = (uint32_t)(size_t)arg * KEYS_PER_THD;
+
+  for (uint32_t i = 0; i < KEYS_PER_THD; ++i) {
+    my_struct_t obj = { 0, base + i };
+    if (OK != sklist_conc_insert(shared, base + i, &obj, sizeof(obj))) return arg;
+  }
+  // Remove a third of our own keys while the other threads keep inserting
+  for (uint32_t i = 0; i < KEYS_PER_THD; i += 3) {
+    if (OK != sklist_conc_remove(shared, base + i)) return arg;
+  }
+  for (uint32_t i = 1; i < KEYS_PER_THD; i += 3) {
+    my_struct_t *ret = (my_struct_t *)sklist_conc_search(shared, base + i);
+    if ((NULL == ret) || (ret->data != base + i)) return arg;
+  }
+
+  return NULL;
+}
+
+void test_sklist_concurrent() {
+  pthread_t thds[NUM_THREADS];
+  uint32_t  errors = 0;
+
+  shared = sklist_conc_create();
+  TEST_ASSERT_EQUAL_VAL_MSG(true, NULL != shared, "Failed to create the concurrent list");
+
+  for (size_t t = 0; t < NUM_THREADS; ++t) {
+    pthread_create(&thds[t], NULL, conc_worker, (void *)t);
+  }
+  for (size_t t = 0; t < NUM_THREADS; ++t) {
+    void *ret = NULL;
+    pthread_join(thds[t], &ret);
+    if (NULL != ret) ++errors;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(0, errors, "Workers shall insert, remove and find their keys");
+
+  uint32_t const removed = (KEYS_PER_THD + 2) / 3;
+  TEST_ASSERT_EQUAL_VAL_MSG(NUM_THREADS * (KEYS_PER_THD - removed), sklist_conc_get_size(shared),
+                            "Size after concurrent updates");
+
+  range_ctx_t r = { 0, 0, NUM_THREADS * KEYS_PER_THD, true };
+  TEST_ASSERT_EQUAL_VAL_MSG(sklist_conc_get_size(shared),
+                            sklist_conc_range(shared, 0, NUM_THREADS * KEYS_PER_THD, check_range, &r),
+                            "Range shall visit every live key");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, r.ordered, "Range shall be visited in ascending order");
+
+  my_struct_t obj = { 0, 1 };
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, sklist_conc_insert(shared, 1, &obj, sizeof(obj)), "Duplicated key");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, sklist_conc_remove(shared, 0), "Key already removed");
+  TEST_ASSERT_EQUAL_MSG(NULL, sklist_conc_search(shared, 0), "Removed key shall not be found");
+
+  sklist_conc_reclaim(shared);
+  sklist_conc_destroy(&shared);
+  TEST_ASSERT_EQUAL_MSG(NULL, shared, "Handle shall be NULL after destroy");
+}
+
+int main() {
+  uTEST_INIT("test_sklist.c");
+  uTEST_ADD_MSG(test_sklist_no_macros, "Skip list insert, search, range and remove with no macros");
+  uTEST_ADD_MSG(test_sklist_with_macros, "Skip list test with macros");
+  uTEST_ADD_MSG(test_sklist_concurrent, "Concurrent skip list shared by several threads");
+  return (uTEST_END());
+}
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C_UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_twheel.c
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for testing the Hierarchical Timing Wheel library.
+ */
+
+#include "twheel.h"
+#include "uTest.h"
+#include <stdlib.h> /* rand, srand */
+
+#define RANDOM_TIMERS (10000)
+#define RANDOM_RANGE  (1000000)
+
+TWHEEL_CREATE(timeouts);
+
+typedef struct conn_s {
+  tw_timer_t timeout;
+  uint64_t   due;     // Expected expiration tick
+  uint64_t   fired;   // Tick of the expiration
+  uint32_t   expired; // Number of expirations
+} conn_t;
+
+static void on_timeout(tw_timer_t *timer, void *ctx) {
+  conn_t *conn = (conn_t *)ctx;
+  conn->fired  = timer->wheel->now;
+  ++conn->expired;
+}
+
+void twheel_levels_test(void) {
+  uint64_t const delays[] = { 0, 1, 63, 64, 65, 127, 4095, 4096, 4097, 262143, 262144, 300000 };
+  uint32_t const n        = sizeof(delays) / sizeof(delays[0]);
+  conn_t         conns[sizeof(delays) / sizeof(delays[0])];
+  uint32_t       mismatches = 0;
+  uint32_t       expired    = 0;
+
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, twheel_init(NULL, 0), "Wheel init error");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, twheel_timer_init(&conns[0].timeout, NULL, NULL), "Timer init error");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, twheel_advance(&timeouts, 1000), "Empty wheel advance");
+  TEST_ASSERT_EQUAL_VAL_MSG(1000, timeouts.now, "Empty wheel moves the tick");
+
+  for (uint32_t i = 0; i < n; ++i) {
+    twheel_timer_init(&conns[i].timeout, on_timeout, &conns[i]);
+    conns[i].due     = timeouts.now + ((0 == delays[i]) ? 1 : delays[i]);
+    conns[i].expired = 0;
+    twheel_add(&timeouts, &conns[i].timeout, delays[i]);
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(n, timeouts.count, "Pending timers");
+  TEST_ASSERT_EQUAL_VAL_MSG(true, twheel_pending(&conns[5].timeout), "Timer pending");
+
+  // One tick at a time, each timer shall expire exactly on its tick
+  for (uint32_t tick = 0; tick < 300000; ++tick) expired += twheel_advance(&timeouts, 1);
+  for (uint32_t i = 0; i < n; ++i) {
+    if ((1 != conns[i].expired) || (conns[i].due != conns[i].fired)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(n, expired, "Every timer expired");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Expired on the due tick across the levels");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, twheel_pending(&conns[5].timeout), "Timer not pending after expiring");
+  TEST_ASSERT_EQUAL_VAL_MSG(NOT_OK, twheel_cancel(&conns[5].timeout), "Cancel an expired timer");
+}
+
+void twheel_random_test(void) {
+  static conn_t conns[RANDOM_TIMERS];
+  twheel_t      wheel;
+  uint32_t      mismatches = 0;
+  uint32_t      expired    = 0;
+  uint32_t      cancelled  = 0;
+
+  srand(26);
+  twheel_init(&wheel, 123456789);
+  for (uint32_t i = 0; i < RANDOM_TIMERS; ++i) {
+    uint64_t const delay = 1 + (uint64_t)rand() % RANDOM_RANGE;
+    twheel_timer_init(&conns[i].timeout, on_timeout, &conns[i]);
+    conns[i].due     = wheel.now + delay;
+    conns[i].expired = 0;
+    twheel_add(&wheel, &conns[i].timeout, delay);
+  }
+  // Re-arm a quarter and cancel another quarter
+  for (uint32_t i = 0; i < RANDOM_TIMERS / 4; ++i) {
+    conns[i].due = wheel.now + 5000 + i;
+    twheel_add(&wheel, &conns[i].timeout, 5000 + i);
+    if (OK == twheel_cancel(&conns[RANDOM_TIMERS - 1 - i].timeout)) ++cancelled;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(RANDOM_TIMERS / 4, cancelled, "Cancelled pending timers");
+  TEST_ASSERT_EQUAL_VAL_MSG(RANDOM_TIMERS - cancelled, wheel.count, "Pending after re-arm and cancel");
+
+  // Uneven jumps, the expiration tick shall still be exact
+  while (0 < wheel.count) expired += twheel_advance(&wheel, 1 + (uint64_t)rand() % 700);
+  for (uint32_t i = 0; i < RANDOM_TIMERS; ++i) {
+    uint32_t const expected = (i < RANDOM_TIMERS - RANDOM_TIMERS / 4) ? 1 : 0;
+    if (expected != conns[i].expired) ++mismatches;
+    if ((1 == expected) && (conns[i].due != conns[i].fired)) ++mismatches;
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(RANDOM_TIMERS - cancelled, expired, "Every pending timer expired");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, mismatches, "Random timers expired once on the due tick");
+}
+
+static twheel_t batch_wheel;
+static conn_t   batch_conns[3];
+
+/* The first one expired re-arms itself and cancels the others of the same tick */
+static void on_batch(tw_timer_t *timer, void *ctx) {
+  conn_t *conn = (conn_t *)ctx;
+  ++conn->expired;
+  for (uint32_t i = 0; i < 3; ++i) twheel_cancel(&batch_conns[i].timeout);
+  if (1 == conn->expired) twheel_add(&batch_wheel, timer, 10);
+}
+
+void twheel_batch_test(void) {
+  twheel_init(&batch_wheel, 0);
+  for (uint32_t i = 0; i < 3; ++i) {
+    batch_conns[i].expired = 0;
+    twheel_timer_init(&batch_conns[i].timeout, on_batch, &batch_conns[i]);
+    twheel_add(&batch_wheel, &batch_conns[i].timeout, 70);
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(1, twheel_advance(&batch_wheel, 70), "Batch cancelled by its first callback");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, batch_wheel.count, "Re-armed from the callback");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, twheel_advance(&batch_wheel, 10), "Re-armed timer expired");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, batch_wheel.count, "Wheel empty");
+
+  // Longer than the wheel range, clamped
+  conn_t far = { 0 };
+  twheel_timer_init(&far.timeout, on_timeout, &far);
+  twheel_add(&batch_wheel, &far.timeout, TWHEEL_MAX_DELAY + 1000);
+  TEST_ASSERT_EQUAL_VAL_MSG(batch_wheel.now + TWHEEL_MAX_DELAY, far.timeout.expires, "Clamped delay");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, twheel_advance(&batch_wheel, TWHEEL_MAX_DELAY), "Clamped timer expired");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(twheel_levels_test, "Timing wheel expiration across the levels");
+  uTEST_ADD_MSG(twheel_random_test, "Timing wheel random add, re-arm and cancel");
+  uTEST_ADD_MSG(twheel_batch_test, "Timing wheel batch expiration and callbacks");
+
+  return (uTEST_END());
+}
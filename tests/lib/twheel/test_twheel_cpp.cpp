@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (C) 2023 by Salvador Z                                            *
+ *                                                                             *
+ * This file is part of C-UTILS                                                *
+ *                                                                             *
+ *   Permission is hereby granted, free of charge, to any person obtaining a   *
+ *   copy of this software and associated documentation files (the Software)   *
+ *   to deal in the Software without restriction including without limitation  *
+ *   the rights to use, copy, modify, merge, publish, distribute, sublicense,  *
+ *   and/or sell copies ot the Software, and to permit persons to whom the     *
+ *   Software is furnished to do so, subject to the following conditions:      *
+ *                                                                             *
+ *   The above copyright notice and this permission notice shall be included   *
+ *   in all copies or substantial portions of the Software.                    *
+ *                                                                             *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS   *
+ *   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARANTIES OF MERCHANTABILITY *
+ *   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL   *
+ *   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR      *
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,     *
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE        *
+ *   OR OTHER DEALINGS IN THE SOFTWARE.                                        *
+ ******************************************************************************/
+
+/**
+ * @file test_twheel_cpp.cpp
+ * @author Salvador Z
+ * @date 19 Oct 2026
+ * @brief File for test the C++ wrapper of the Hierarchical Timing Wheel
+ *
+ */
+
+#include "twheel/twheel.hpp"
+#include "uTest.h"
+
+void timing_wheel_test(void) {
+  c_utils::TimingWheel wheel(1000);
+  int                  fired = 0;
+  c_utils::Timer       once([&fired]() { ++fired; });
+  c_utils::Timer       later([&fired]() { fired += 10; });
+
+  wheel.add(once, 100);
+  wheel.add(later, 5000);
+  TEST_ASSERT_EQUAL_VAL_MSG(2, wheel.size(), "Pending timers");
+  TEST_ASSERT_EQUAL_VAL_MSG(0, wheel.advance(99), "Not due yet");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, wheel.advance(1), "Due on its tick");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, fired, "Callback called");
+  TEST_ASSERT_EQUAL_VAL_MSG(false, once.pending(), "Expired timer not pending");
+
+  wheel.add(once, 10);
+  TEST_ASSERT_EQUAL_VAL_MSG(true, once.cancel(), "Cancel pending timer");
+  {
+    c_utils::Timer scoped([&fired]() { fired = -1; });
+    wheel.add(scoped, 1);
+  }
+  TEST_ASSERT_EQUAL_VAL_MSG(1, wheel.size(), "Destroyed timer cancelled");
+  TEST_ASSERT_EQUAL_VAL_MSG(1, wheel.advance(10000), "Long jump");
+  TEST_ASSERT_EQUAL_VAL_MSG(11, fired, "Only the pending timer expired");
+  TEST_ASSERT_EQUAL_VAL_MSG(11100, wheel.now(), "Current tick");
+}
+
+int main(void) {
+  uTEST_START();
+  uTEST_ADD_MSG(timing_wheel_test, "Timing wheel C++ wrapper");
+
+  return (uTEST_END());
+}